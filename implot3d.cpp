@@ -17,6 +17,7 @@
 // [SECTION] Legend Utils
 // [SECTION] Mouse Position Utils
 // [SECTION] Plot Box Utils
+// [SECTION] Transforms
 // [SECTION] Formatter
 // [SECTION] Locator
 // [SECTION] Context Menus
@@ -34,8 +35,11 @@
 // [SECTION] ImPlot3DRange
 // [SECTION] ImPlot3DQuat
 // [SECTION] ImDrawList3D
+// [SECTION] ImPlot3DFrameArena
 // [SECTION] ImPlot3DAxis
 // [SECTION] ImPlot3DPlot
+// [SECTION] ImPlot3DProgressive
+// [SECTION] ImPlot3DHeatmap
 // [SECTION] ImPlot3DStyle
 // [SECTION] Metrics
 // [SECTION] Obsolete API
@@ -48,6 +52,14 @@ Below is a change-log of API breaking changes only. If you are using one of the
 When you are not sure about an old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all
 implot3d files. You can read releases logs https://github.com/brenocq/implot3d/releases for more details.
 
+- 2026/10/18 (0.4) - ImDrawList3D no longer stores full ImDrawVert vertices (internal API only):
+                      - ImDrawList3D::VtxBuffer and ImDrawList3D::_VtxWritePtr were replaced by PosBuffer and _PosWritePtr (ImVec2 positions).
+                      - Vertex UVs and colors are set with ImDrawList3D::SetVtxStyle() before reserving vertices. Per-vertex colors are written
+                        to _ColWritePtr.
+                      - Triangles added after ImDrawList3D::SetPrimFan(n) with n >= 3 have their indices generated while sorting and must not be
+                        written to _IdxWritePtr. Call SetPrimFan(0) before reserving to keep writing explicit indices.
+                      - ImDrawList3D::ZBuffer holds one depth per fan instead of one per triangle (e.g. one per quad), unless SetPrimFan is
+                        called with key_per_tri = true.
 - 2026/02/03 (0.4) - ImPlotSpec was made the default and _only_ way of styling plot items. The SetNextXXXStyle functions have been removed.
                       - SetNextLineStyle has been removed, styling should be set via ImPlot3DSpec.
                           ```cpp
@@ -130,6 +142,15 @@ implot3d files. You can read releases logs https://github.com/brenocq/implot3d/r
 #include "implot3d.h"
 #include "implot3d_internal.h"
 
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h> // QueryPerformanceCounter
+#else
+#include <time.h> // clock_gettime
+#endif
+
 #ifndef IMGUI_DISABLE
 
 //-----------------------------------------------------------------------------
@@ -162,15 +183,32 @@ ImPlot3DContext* CreateContext() {
 void DestroyContext(ImPlot3DContext* ctx) {
     if (ctx == nullptr)
         ctx = GImPlot3D;
-    if (GImPlot3D == ctx)
-        SetCurrentContext(nullptr);
+    ImPlot3DContext* prev_ctx = GImPlot3D;
+    // Item textures are released immediately while no context is current
+    SetCurrentContext(nullptr);
+#ifdef IMGUI_HAS_TEXTURES
+    for (int i = 0; i < ctx->TexturesToDestroy.Size; i++)
+        DestroyItemTexture(ctx->TexturesToDestroy[i]);
+    ctx->TexturesToDestroy.clear();
+    ctx->TexturesToDestroyFrame.clear();
+#endif
     IM_DELETE(ctx);
+    if (prev_ctx != ctx)
+        SetCurrentContext(prev_ctx);
 }
 
 ImPlot3DContext* GetCurrentContext() { return GImPlot3D; }
 
 void SetCurrentContext(ImPlot3DContext* ctx) { GImPlot3D = ctx; }
 
+void SetFrameAllocatorFunctions(ImPlot3DFrameAllocFunc alloc_func, ImPlot3DFrameResetFunc reset_func, void* user_data) {
+    IMPLOT3D_CHECK_CTX();
+    ImPlot3DFrameArena& arena = GImPlot3D->FrameArena;
+    arena.AllocFunc = alloc_func;
+    arena.ResetFunc = reset_func;
+    arena.UserData = user_data;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Text Utils
 //-----------------------------------------------------------------------------
@@ -455,24 +493,20 @@ void RenderMousePos() {
     if (mouse_plot_pos.IsNaN())
         mouse_plot_pos = PixelsToPlotPlane(mouse_pos, ImPlane3D_XY, true);
 
-    char buff[IMPLOT3D_LABEL_MAX_SIZE];
+    char buff[3][IMPLOT3D_LABEL_MAX_SIZE];
     if (!mouse_plot_pos.IsNaN()) {
-        ImGuiTextBuffer builder;
-        builder.append("(");
         for (int i = 0; i < 3; i++) {
             ImPlot3DAxis& axis = plot.Axes[i];
-            if (i > 0)
-                builder.append(", ");
-            axis.Formatter(mouse_plot_pos[i], buff, IMPLOT3D_LABEL_MAX_SIZE, axis.FormatterData);
-            builder.append(buff);
+            axis.Formatter(mouse_plot_pos[i], buff[i], IMPLOT3D_LABEL_MAX_SIZE, axis.FormatterData);
         }
-        builder.append(")");
+        char text[3 * IMPLOT3D_LABEL_MAX_SIZE + 8];
+        ImFormatString(text, sizeof(text), "(%s, %s, %s)", buff[0], buff[1], buff[2]);
 
-        const ImVec2 size = ImGui::CalcTextSize(builder.c_str());
+        const ImVec2 size = ImGui::CalcTextSize(text);
         // TODO custom location/padding
         const ImVec2 pos = GetLocationPos(plot.PlotRect, size, ImPlot3DLocation_SouthEast, ImVec2(10, 10));
         ImDrawList& draw_list = *ImGui::GetWindowDrawList();
-        draw_list.AddText(pos, GetStyleColorU32(ImPlot3DCol_InlayText), builder.c_str());
+        draw_list.AddText(pos, GetStyleColorU32(ImPlot3DCol_InlayText), text);
     }
 }
 
@@ -1077,7 +1111,7 @@ ImPlot3DPoint PlotToNDC(const ImPlot3DPlot& plot, const ImPlot3DPoint& point) {
         double plt = point[i];
         double t;
         if (axis.TransformForward != nullptr) {
-            double s = axis.TransformForward(plt, axis.TransformData);
+            double s = plot.PreScaled ? plt : AxisTransformForward(axis, plt);
             t = (s - axis.ScaledRange.Min) / (axis.ScaledRange.Max - axis.ScaledRange.Min);
         } else {
             t = (plt - axis.Range.Min) / (axis.Range.Max - axis.Range.Min);
@@ -1218,6 +1252,88 @@ void RenderPlotBox(ImDrawList* draw_list, const ImPlot3DPlot& plot) {
     RenderAxisLabels(draw_list, plot, corners, corners_pix, axis_corners);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Transforms
+//-----------------------------------------------------------------------------
+
+// Natural logarithm of a finite positive double, without branches or library calls so that loops calling it can be vectorized. Subnormals are
+// treated as DBL_MIN. Error is below 1 ulp for normal inputs
+static inline double LogFinitePositive(double v) {
+    v = v < DBL_MIN ? DBL_MIN : v;
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    // Split v = m * 2^e with m in [1, 2)
+    ImU64 m_bits = (bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+    ImU64 e_bits = (bits >> 52) | 0x4330000000000000ull; // 2^52 + biased exponent, converted below without an int64 -> double instruction
+    double m, e;
+    memcpy(&m, &m_bits, sizeof(m));
+    memcpy(&e, &e_bits, sizeof(e));
+    e -= 4503599627370496.0 + 1023.0;
+    // Move m to [sqrt(1/2), sqrt(2)) so that the series below converges quickly
+    const bool big = m > 1.4142135623730951;
+    m = big ? m * 0.5 : m;
+    e = big ? e + 1.0 : e;
+    // log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1), |s| < 0.1716
+    const double s = (m - 1.0) / (m + 1.0);
+    const double s2 = s * s;
+    double p = 2.0 / 21.0;
+    p = p * s2 + 2.0 / 19.0;
+    p = p * s2 + 2.0 / 17.0;
+    p = p * s2 + 2.0 / 15.0;
+    p = p * s2 + 2.0 / 13.0;
+    p = p * s2 + 2.0 / 11.0;
+    p = p * s2 + 2.0 / 9.0;
+    p = p * s2 + 2.0 / 7.0;
+    p = p * s2 + 2.0 / 5.0;
+    p = p * s2 + 2.0 / 3.0;
+    p = p * s2 + 2.0;
+    // log(2) split in high and low parts to keep precision for large exponents
+    return e * 6.93147180369123816490e-01 + (s * p + e * 1.90821492927058770002e-10);
+}
+
+void TransformForwardBatch_Log10(const double* values, double* out, int count, void*) {
+    const double inv_ln10 = 0.43429448190325182765;
+    for (int i = 0; i < count; i++) {
+        const double v = values[i];
+        const double r = LogFinitePositive(v) * inv_ln10;
+        // NaN and +inf are passed through
+        out[i] = v <= DBL_MAX ? r : v;
+    }
+}
+
+void TransformForwardBatch_SymLog(const double* values, double* out, int count, void*) {
+    for (int i = 0; i < count; i++) {
+        // 2 * asinh(v / 2), with asinh(a) = log(a + sqrt(a^2 + 1)) for a >= 0
+        const double v = values[i];
+        const double a = ImAbs(v) * 0.5;
+        const double arg = a > 1e150 ? 2.0 * a : a + ImSqrt(a * a + 1.0); // Avoid overflowing a^2
+        // Near zero the logarithm above loses precision, use the Taylor series of asinh instead
+        const double a2 = a * a;
+        double p = 0.011551800896139705;
+        p = p * a2 - 0.01396484375;
+        p = p * a2 + 0.017352764423076924;
+        p = p * a2 - 0.022372159090909092;
+        p = p * a2 + 0.030381944444444444;
+        p = p * a2 - 0.044642857142857144;
+        p = p * a2 + 0.075;
+        p = p * a2 - 0.16666666666666666;
+        p = p * a2 + 1.0;
+        const double r = 2.0 * (a < 0.125 ? a * p : LogFinitePositive(arg));
+        out[i] = ImAbs(v) <= DBL_MAX ? (v < 0.0 ? -r : r) : v;
+    }
+}
+
+void AxisTransformForwardBatch(const ImPlot3DAxis& axis, const double* values, double* out, int count) {
+    if (axis.TransformForwardBatch != nullptr) {
+        axis.TransformForwardBatch(values, out, count, axis.TransformData);
+    } else if (axis.TransformForward != nullptr) {
+        for (int i = 0; i < count; i++)
+            out[i] = axis.TransformForward(values[i], axis.TransformData);
+    } else if (out != values) {
+        memcpy(out, values, sizeof(double) * count);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Formatter
 //-----------------------------------------------------------------------------
@@ -1562,6 +1678,17 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlot3DFlags flags) {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "Mismatched BeginPlot()/EndPlot()!");
 
+#ifdef IMGUI_HAS_TEXTURES
+    // Release item textures that are no longer referenced
+    UpdateItemTextures();
+#endif
+
+    // Release the transient allocations of the previous frame
+    if (gp.FrameArena.ResetFrame != ImGui::GetFrameCount()) {
+        gp.FrameArena.Reset();
+        gp.FrameArena.ResetFrame = ImGui::GetFrameCount();
+    }
+
     // Get window
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
@@ -1618,6 +1745,15 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlot3DFlags flags) {
     // Reset legend
     plot.Items.Legend.Reset();
 
+    // Reset rendering statistics
+    plot.LODPrevPointCount = plot.Stats.PointsRequested;
+    plot.LODPrevTriCount = plot.Stats.TrisRequested;
+    plot.LODPointBudget = 100000;
+    plot.LODTriBudget = 400000;
+    plot.Progressive.PrimBudget = 200000;
+    plot.Progressive.TimeBudget = 0.0;
+    plot.Stats.Reset();
+
     // Reset axes
     for (int i = 0; i < ImAxis3D_COUNT; i++)
         plot.Axes[i].Reset();
@@ -1636,8 +1772,18 @@ void EndPlot() {
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "Mismatched BeginPlot()/EndPlot()!");
     ImPlot3DPlot& plot = *gp.CurrentPlot;
 
+    // Calls missing this frame (e.g. items hidden or no longer plotted) left their geometry in the retained draw list, restart without them
+    if (plot.Progressive.Active && plot.Progressive.CallIdx != plot.Progressive.Calls.Size)
+        plot.Progressive.Restart = true;
+
     // Move triangles from 3D draw list to ImGui draw list
-    plot.DrawList.SortedMoveToImGuiDrawList();
+    plot.Stats.VtxCount = plot.DrawList.PosBuffer.Size;
+    const int idx_count_before = ImGui::GetWindowDrawList()->IdxBuffer.Size;
+    const double sort_start = GetTimeMs();
+    plot.Stats.TrisDropped = plot.DrawList.SortedMoveToImGuiDrawList(plot.Progressive.Active);
+    plot.Stats.SortTime = GetTimeMs() - sort_start;
+    plot.Stats.SortKeyCount = plot.DrawList._SortKeyCount;
+    plot.Stats.TriCount = (ImGui::GetWindowDrawList()->IdxBuffer.Size - idx_count_before) / 3;
 
     // Handle data fitting
     if (plot.FitThisFrame) {
@@ -1814,9 +1960,10 @@ void SetupAxisTicks(ImAxis3D idx, double v_min, double v_max, int n_ticks, const
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
                          "Setup needs to be called after BeginPlot and before any setup locking functions (e.g. PlotX)!");
     n_ticks = n_ticks < 2 ? 2 : n_ticks;
-    ImVector<double> temp;
-    FillRange(temp, n_ticks, v_min, v_max);
-    SetupAxisTicks(idx, temp.Data, n_ticks, labels, keep_default);
+    double* values = (double*)FrameAlloc(sizeof(double) * n_ticks);
+    for (int i = 0; i < n_ticks; i++)
+        values[i] = v_min + i * (v_max - v_min) / (n_ticks - 1);
+    SetupAxisTicks(idx, values, n_ticks, labels, keep_default);
 }
 
 void SetupAxisScale(ImAxis3D idx, ImPlot3DScale scale) {
@@ -1830,6 +1977,7 @@ void SetupAxisScale(ImAxis3D idx, ImPlot3DScale scale) {
         case ImPlot3DScale_Log10:
             axis.TransformForward = TransformForward_Log10;
             axis.TransformInverse = TransformInverse_Log10;
+            axis.TransformForwardBatch = TransformForwardBatch_Log10;
             axis.TransformData = nullptr;
             axis.Locator = Locator_Log10;
             axis.ConstraintRange = ImPlot3DRange(FLT_MIN, INFINITY);
@@ -1837,6 +1985,7 @@ void SetupAxisScale(ImAxis3D idx, ImPlot3DScale scale) {
         case ImPlot3DScale_SymLog:
             axis.TransformForward = TransformForward_SymLog;
             axis.TransformInverse = TransformInverse_SymLog;
+            axis.TransformForwardBatch = TransformForwardBatch_SymLog;
             axis.TransformData = nullptr;
             axis.Locator = Locator_SymLog;
             axis.ConstraintRange = ImPlot3DRange(-INFINITY, INFINITY);
@@ -1844,6 +1993,7 @@ void SetupAxisScale(ImAxis3D idx, ImPlot3DScale scale) {
         default:
             axis.TransformForward = nullptr;
             axis.TransformInverse = nullptr;
+            axis.TransformForwardBatch = nullptr;
             axis.TransformData = nullptr;
             axis.Locator = nullptr;
             axis.ConstraintRange = ImPlot3DRange(-INFINITY, INFINITY);
@@ -1860,9 +2010,15 @@ void SetupAxisScale(ImAxis3D idx, ImPlot3DTransform forward, ImPlot3DTransform i
     axis.Scale = IMPLOT3D_AUTO;
     axis.TransformForward = forward;
     axis.TransformInverse = inverse;
+    axis.TransformForwardBatch = nullptr;
     axis.TransformData = data;
 }
 
+void SetupAxisScale(ImAxis3D idx, ImPlot3DTransform forward, ImPlot3DTransform inverse, void* data, ImPlot3DTransformBatch forward_batch) {
+    SetupAxisScale(idx, forward, inverse, data);
+    GImPlot3D->CurrentPlot->Axes[idx].TransformForwardBatch = forward_batch;
+}
+
 void SetupAxisLimitsConstraints(ImAxis3D idx, double v_min, double v_max) {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
@@ -1954,6 +2110,26 @@ void SetupBoxScale(double x, double y, double z) {
     plot.Axes[2].NDCScale = z;
 }
 
+void SetupInteractiveLOD(int point_budget, int triangle_budget) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
+                         "SetupInteractiveLOD() needs to be called after BeginPlot() and before any setup locking functions (e.g. PlotX)!");
+    IM_ASSERT_USER_ERROR(point_budget > 0 && triangle_budget > 0, "SetupInteractiveLOD() requires budgets greater than 0!");
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    plot.LODPointBudget = point_budget;
+    plot.LODTriBudget = triangle_budget;
+}
+
+void SetupProgressive(int prim_budget, double time_budget_ms) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
+                         "SetupProgressive() needs to be called after BeginPlot() and before any setup locking functions (e.g. PlotX)!");
+    IM_ASSERT_USER_ERROR(prim_budget > 0 && time_budget_ms >= 0.0, "SetupProgressive() requires a positive budget!");
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    plot.Progressive.PrimBudget = prim_budget;
+    plot.Progressive.TimeBudget = time_budget_ms;
+}
+
 void SetupLegend(ImPlot3DLocation location, ImPlot3DLegendFlags flags) {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
@@ -2668,6 +2844,51 @@ void HandleInput(ImPlot3DPlot& plot) {
     }
 }
 
+// Starts a frame of progressive refinement (see ImPlot3DFlags_Progressive). The geometry retained in the plot draw list is dropped if the view
+// changed, or if the data or style of an item changed or an item wasn't rendered in the last frame
+static void UpdateProgressive(ImPlot3DPlot& plot) {
+    ImPlot3DProgressive& prog = plot.Progressive;
+
+    // Hash everything the projected geometry depends on
+    double view[18];
+    view[0] = plot.Rotation.x;
+    view[1] = plot.Rotation.y;
+    view[2] = plot.Rotation.z;
+    view[3] = plot.Rotation.w;
+    view[4] = plot.PlotRect.Min.x;
+    view[5] = plot.PlotRect.Min.y;
+    view[6] = plot.PlotRect.Max.x;
+    view[7] = plot.PlotRect.Max.y;
+    view[8] = plot.IsLODActive() ? 1.0 : 0.0;
+    for (int i = 0; i < 3; i++) {
+        view[9 + i * 3 + 0] = plot.Axes[i].Range.Min;
+        view[9 + i * 3 + 1] = plot.Axes[i].Range.Max;
+        view[9 + i * 3 + 2] = plot.Axes[i].NDCScale;
+    }
+    ImGuiID view_hash = ImHashData(view, sizeof(view));
+    for (int i = 0; i < 3; i++) {
+        view_hash = ImHashData(&plot.Axes[i].TransformForward, sizeof(ImPlot3DTransform), view_hash);
+        view_hash = ImHashData(&plot.Axes[i].TransformData, sizeof(void*), view_hash);
+    }
+
+    // Items without a data version may change at any time, render them in full every frame
+    const bool enabled = ImHasFlag(plot.Flags, ImPlot3DFlags_Progressive) && prog.AllVersioned;
+    if (!enabled || !prog.Active || prog.Restart || prog.ViewHash != view_hash) {
+        plot.DrawList.ResetBuffers();
+        prog.Calls.shrink(0);
+        prog.Restart = false;
+    }
+    prog.Active = enabled;
+    prog.AllVersioned = true;
+    prog.ViewHash = view_hash;
+    prog.CallIdx = 0;
+    prog.PrimCount = 0;
+    for (int i = 0; i < prog.Calls.Size; i++)
+        prog.PrimCount += prog.Calls[i].Count;
+    prog.PrimsLeft = prog.PrimBudget;
+    prog.StartTime = GetTimeMs();
+}
+
 void SetupLock() {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "SetupLock() needs to be called between BeginPlot() and EndPlot()!");
@@ -2756,6 +2977,9 @@ void SetupLock() {
 
     // Render plot box
     RenderPlotBox(draw_list, plot);
+
+    // Decide whether the geometry retained from the last frame can be refined
+    UpdateProgressive(plot);
 }
 
 //-----------------------------------------------------------------------------
@@ -2764,6 +2988,15 @@ void SetupLock() {
 
 ImDrawList* GetPlotDrawList() { return ImGui::GetWindowDrawList(); }
 
+ImDrawList3D* GetPlotDrawList3D() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetPlotDrawList3D() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    // Geometry written directly has no data version, so the plot can't retain its draw list across frames (see ImPlot3DFlags_Progressive)
+    gp.CurrentPlot->Progressive.AllVersioned = false;
+    return &gp.CurrentPlot->DrawList;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Styles
 //-----------------------------------------------------------------------------
@@ -3241,6 +3474,26 @@ void ResetContext(ImPlot3DContext* ctx) {
     ctx->CurrentItem = nullptr;
     ctx->NextItemData.Reset();
     ctx->Style = ImPlot3DStyle();
+#ifdef IMGUI_HAS_TEXTURES
+    ctx->MarkerSprites.clear();
+    ctx->MarkerSpriteAtlas = nullptr;
+#endif
+}
+
+void* FrameAlloc(size_t size) { return GImPlot3D->FrameArena.Alloc(size); }
+
+double GetTimeMs() {
+    // clock() measures the CPU time of all the threads of the process on POSIX, use the monotonic clock instead
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return 1000.0 * (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000.0 * (double)ts.tv_sec + (double)ts.tv_nsec / 1000000.0;
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -3283,64 +3536,8 @@ const ImPlot3DNextItemData& GetItemData() { return GImPlot3D->NextItemData; }
 // [SECTION] ImPlot3DPoint
 //-----------------------------------------------------------------------------
 
-ImPlot3DPoint ImPlot3DPoint::operator*(double rhs) const { return ImPlot3DPoint(x * rhs, y * rhs, z * rhs); }
-ImPlot3DPoint ImPlot3DPoint::operator/(double rhs) const { return ImPlot3DPoint(x / rhs, y / rhs, z / rhs); }
-ImPlot3DPoint ImPlot3DPoint::operator+(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x + rhs.x, y + rhs.y, z + rhs.z); }
-ImPlot3DPoint ImPlot3DPoint::operator-(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x - rhs.x, y - rhs.y, z - rhs.z); }
-ImPlot3DPoint ImPlot3DPoint::operator*(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x * rhs.x, y * rhs.y, z * rhs.z); }
-ImPlot3DPoint ImPlot3DPoint::operator/(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x / rhs.x, y / rhs.y, z / rhs.z); }
-ImPlot3DPoint ImPlot3DPoint::operator-() const { return ImPlot3DPoint(-x, -y, -z); }
-
-ImPlot3DPoint& ImPlot3DPoint::operator*=(double rhs) {
-    x *= rhs;
-    y *= rhs;
-    z *= rhs;
-    return *this;
-}
-ImPlot3DPoint& ImPlot3DPoint::operator/=(double rhs) {
-    x /= rhs;
-    y /= rhs;
-    z /= rhs;
-    return *this;
-}
-ImPlot3DPoint& ImPlot3DPoint::operator+=(const ImPlot3DPoint& rhs) {
-    x += rhs.x;
-    y += rhs.y;
-    z += rhs.z;
-    return *this;
-}
-ImPlot3DPoint& ImPlot3DPoint::operator-=(const ImPlot3DPoint& rhs) {
-    x -= rhs.x;
-    y -= rhs.y;
-    z -= rhs.z;
-    return *this;
-}
-ImPlot3DPoint& ImPlot3DPoint::operator*=(const ImPlot3DPoint& rhs) {
-    x *= rhs.x;
-    y *= rhs.y;
-    z *= rhs.z;
-    return *this;
-}
-ImPlot3DPoint& ImPlot3DPoint::operator/=(const ImPlot3DPoint& rhs) {
-    x /= rhs.x;
-    y /= rhs.y;
-    z /= rhs.z;
-    return *this;
-}
-
-bool ImPlot3DPoint::operator==(const ImPlot3DPoint& rhs) const { return x == rhs.x && y == rhs.y && z == rhs.z; }
-bool ImPlot3DPoint::operator!=(const ImPlot3DPoint& rhs) const { return !(*this == rhs); }
-
-double ImPlot3DPoint::Dot(const ImPlot3DPoint& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z; }
-
-ImPlot3DPoint ImPlot3DPoint::Cross(const ImPlot3DPoint& rhs) const {
-    return ImPlot3DPoint(y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x);
-}
-
 double ImPlot3DPoint::Length() const { return sqrt(x * x + y * y + z * z); }
 
-double ImPlot3DPoint::LengthSquared() const { return x * x + y * y + z * z; }
-
 void ImPlot3DPoint::Normalize() {
     double l = Length();
     x /= l;
@@ -3353,10 +3550,30 @@ ImPlot3DPoint ImPlot3DPoint::Normalized() const {
     return ImPlot3DPoint(x / l, y / l, z / l);
 }
 
-ImPlot3DPoint operator*(double lhs, const ImPlot3DPoint& rhs) { return ImPlot3DPoint(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z); }
-
 bool ImPlot3DPoint::IsNaN() const { return ImPlot3D::ImNan(x) || ImPlot3D::ImNan(y) || ImPlot3D::ImNan(z); }
 
+void ImPlot3DPoint::Centroids(const ImPlot3DPoint* in, int group_size, ImPlot3DPoint* out, int count) {
+    IM_ASSERT(group_size > 0);
+    const double inv_size = 1.0 / group_size;
+    // Common group sizes are unrolled so that the loops vectorize
+    if (group_size == 3) {
+        for (int i = 0; i < count; i++, in += 3)
+            out[i] = ImPlot3DPoint((in[0].x + in[1].x + in[2].x) * inv_size, (in[0].y + in[1].y + in[2].y) * inv_size,
+                                   (in[0].z + in[1].z + in[2].z) * inv_size);
+    } else if (group_size == 4) {
+        for (int i = 0; i < count; i++, in += 4)
+            out[i] = ImPlot3DPoint((in[0].x + in[1].x + in[2].x + in[3].x) * inv_size, (in[0].y + in[1].y + in[2].y + in[3].y) * inv_size,
+                                   (in[0].z + in[1].z + in[2].z + in[3].z) * inv_size);
+    } else {
+        for (int i = 0; i < count; i++) {
+            ImPlot3DPoint sum;
+            for (int j = 0; j < group_size; j++)
+                sum += *in++;
+            out[i] = sum * inv_size;
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DBox
 //-----------------------------------------------------------------------------
@@ -3525,18 +3742,11 @@ ImPlot3DQuat ImPlot3DQuat::Normalized() const {
     return ImPlot3DQuat(x / l, y / l, z / l, w / l);
 }
 
-ImPlot3DQuat ImPlot3DQuat::Conjugate() const { return ImPlot3DQuat(-x, -y, -z, w); }
-
 ImPlot3DQuat ImPlot3DQuat::Inverse() const {
     double l_squared = x * x + y * y + z * z + w * w;
     return ImPlot3DQuat(-x / l_squared, -y / l_squared, -z / l_squared, w / l_squared);
 }
 
-ImPlot3DQuat ImPlot3DQuat::operator*(const ImPlot3DQuat& rhs) const {
-    return ImPlot3DQuat(w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y, w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
-                        w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w, w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z);
-}
-
 ImPlot3DQuat& ImPlot3DQuat::Normalize() {
     double l = Length();
     x /= l;
@@ -3546,22 +3756,22 @@ ImPlot3DQuat& ImPlot3DQuat::Normalize() {
     return *this;
 }
 
-ImPlot3DPoint ImPlot3DQuat::operator*(const ImPlot3DPoint& point) const {
-    // Extract vector part of the quaternion
-    ImPlot3DPoint qv(x, y, z);
-
-    // Compute the cross products needed for rotation
-    ImPlot3DPoint uv = qv.Cross(point); // uv = qv x point
-    ImPlot3DPoint uuv = qv.Cross(uv);   // uuv = qv x uv
-
-    // Compute the rotated vector
-    return point + (uv * w * 2.0) + (uuv * 2.0);
+void ImPlot3DQuat::Rotate(const ImPlot3DPoint* in, ImPlot3DPoint* out, int count) const {
+    // Rotation matrix of the (unit) quaternion
+    const double xx = x * x, yy = y * y, zz = z * z;
+    const double xy = x * y, xz = x * z, yz = y * z;
+    const double wx = w * x, wy = w * y, wz = w * z;
+    const double m00 = 1.0 - 2.0 * (yy + zz), m01 = 2.0 * (xy - wz), m02 = 2.0 * (xz + wy);
+    const double m10 = 2.0 * (xy + wz), m11 = 1.0 - 2.0 * (xx + zz), m12 = 2.0 * (yz - wx);
+    const double m20 = 2.0 * (xz - wy), m21 = 2.0 * (yz + wx), m22 = 1.0 - 2.0 * (xx + yy);
+    for (int i = 0; i < count; i++) {
+        const double px = in[i].x, py = in[i].y, pz = in[i].z;
+        out[i].x = m00 * px + m01 * py + m02 * pz;
+        out[i].y = m10 * px + m11 * py + m12 * pz;
+        out[i].z = m20 * px + m21 * py + m22 * pz;
+    }
 }
 
-bool ImPlot3DQuat::operator==(const ImPlot3DQuat& rhs) const { return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w; }
-
-bool ImPlot3DQuat::operator!=(const ImPlot3DQuat& rhs) const { return !(*this == rhs); }
-
 ImPlot3DQuat ImPlot3DQuat::Slerp(const ImPlot3DQuat& q1, const ImPlot3DQuat& q2, double t) {
     // Clamp t to [0, 1]
     t = ImClamp(t, 0.0, 1.0);
@@ -3594,34 +3804,46 @@ ImPlot3DQuat ImPlot3DQuat::Slerp(const ImPlot3DQuat& q1, const ImPlot3DQuat& q2,
     return ImPlot3DQuat(s1 * q1.x + s2 * q2_.x, s1 * q1.y + s2 * q2_.y, s1 * q1.z + s2 * q2_.z, s1 * q1.w + s2 * q2_.w);
 }
 
-double ImPlot3DQuat::Dot(const ImPlot3DQuat& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
-
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList3D
 //-----------------------------------------------------------------------------
 
+static bool HasExplicitIdx(const ImVector<ImDrawList3D::ImPrimBufferItem>& buffer) { return buffer.empty() || buffer.back().FanVtxCount == 0; }
+static int GetKeyTriCount(const ImVector<ImDrawList3D::ImPrimBufferItem>& buffer) { return buffer.empty() ? 1 : buffer.back().KeyTriCount; }
+
 void ImDrawList3D::PrimReserve(int idx_count, int vtx_count) {
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0 && idx_count % 3 == 0);
 
-    int vtx_buffer_old_size = VtxBuffer.Size;
-    VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
-    _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
+    int pos_buffer_old_size = PosBuffer.Size;
+    PosBuffer.resize(pos_buffer_old_size + vtx_count);
+    _PosWritePtr = PosBuffer.Data + pos_buffer_old_size;
 
-    int idx_buffer_old_size = IdxBuffer.Size;
-    IdxBuffer.resize(idx_buffer_old_size + idx_count);
-    _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
+    if (!_VtxStyleBuffer.empty() && _VtxStyleBuffer.back().ColOffset != -1) {
+        int col_buffer_old_size = ColBuffer.Size;
+        ColBuffer.resize(col_buffer_old_size + vtx_count);
+        _ColWritePtr = ColBuffer.Data + col_buffer_old_size;
+    }
+
+    if (HasExplicitIdx(_PrimBuffer)) {
+        int idx_buffer_old_size = IdxBuffer.Size;
+        IdxBuffer.resize(idx_buffer_old_size + idx_count);
+        _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
+    }
 
     int z_buffer_old_size = ZBuffer.Size;
-    ZBuffer.resize(z_buffer_old_size + idx_count / 3);
+    ZBuffer.resize(z_buffer_old_size + idx_count / 3 / GetKeyTriCount(_PrimBuffer));
     _ZWritePtr = ZBuffer.Data + z_buffer_old_size;
 }
 
 void ImDrawList3D::PrimUnreserve(int idx_count, int vtx_count) {
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0 && idx_count % 3 == 0);
 
-    VtxBuffer.shrink(VtxBuffer.Size - vtx_count);
-    IdxBuffer.shrink(IdxBuffer.Size - idx_count);
-    ZBuffer.shrink(ZBuffer.Size - idx_count / 3);
+    PosBuffer.shrink(PosBuffer.Size - vtx_count);
+    if (!_VtxStyleBuffer.empty() && _VtxStyleBuffer.back().ColOffset != -1)
+        ColBuffer.shrink(ColBuffer.Size - vtx_count);
+    if (HasExplicitIdx(_PrimBuffer))
+        IdxBuffer.shrink(IdxBuffer.Size - idx_count);
+    ZBuffer.shrink(ZBuffer.Size - idx_count / 3 / GetKeyTriCount(_PrimBuffer));
 }
 
 void ImDrawList3D::SetTexture(ImTextureRef tex_ref) {
@@ -3650,6 +3872,96 @@ void ImDrawList3D::SetTexture(ImTextureRef tex_ref) {
 
 void ImDrawList3D::ResetTexture() { SetTexture(ImTextureID(0)); }
 
+static void PushVtxStyle(ImVector<ImDrawList3D::ImVtxStyleBufferItem>& buffer, const ImDrawList3D::ImVtxStyleBufferItem& item) {
+    if (!buffer.empty()) {
+        ImDrawList3D::ImVtxStyleBufferItem& prev = buffer.back();
+        // No vertex uses the previous style, replace it
+        if (prev.VtxIdx == item.VtxIdx) {
+            prev = item;
+            return;
+        }
+        // Same style as the previous one (per-vertex colors are contiguous in ColBuffer), keep using it
+        bool same = (prev.ColOffset == -1) == (item.ColOffset == -1) && (item.ColOffset != -1 || prev.Col == item.Col) &&
+                    prev.UVCount == item.UVCount && (item.VtxIdx - prev.VtxIdx) % prev.UVCount == 0;
+        for (int i = 0; same && i < item.UVCount; i++)
+            same = prev.UV[i].x == item.UV[i].x && prev.UV[i].y == item.UV[i].y;
+        if (same)
+            return;
+    }
+    buffer.push_back(item);
+}
+
+void ImDrawList3D::SetVtxStyle(ImU32 col, const ImVec2* uvs, int uv_count) {
+    IM_ASSERT(uv_count == 1 || uv_count == 4);
+    ImVtxStyleBufferItem item;
+    item.VtxIdx = _VtxCurrentIdx;
+    item.ColOffset = -1;
+    item.Col = col;
+    item.UVCount = uv_count;
+    for (int i = 0; i < 4; i++)
+        item.UV[i] = uvs[i % uv_count];
+    PushVtxStyle(_VtxStyleBuffer, item);
+}
+
+void ImDrawList3D::SetVtxStyle(const ImVec2* uvs, int uv_count) {
+    IM_ASSERT(uv_count == 1 || uv_count == 4);
+    ImVtxStyleBufferItem item;
+    item.VtxIdx = _VtxCurrentIdx;
+    item.ColOffset = ColBuffer.Size;
+    item.Col = 0;
+    item.UVCount = uv_count;
+    for (int i = 0; i < 4; i++)
+        item.UV[i] = uvs[i % uv_count];
+    PushVtxStyle(_VtxStyleBuffer, item);
+    _ColWritePtr = ColBuffer.Data + ColBuffer.Size;
+}
+
+void ImDrawList3D::SetPrimFan(int fan_vtx_count, bool key_per_tri) {
+    IM_ASSERT(fan_vtx_count == 0 || fan_vtx_count >= 3);
+    ImPrimBufferItem item;
+    item.KeyIdx = (unsigned int)ZBuffer.Size;
+    item.VtxIdx = _VtxCurrentIdx;
+    item.FanVtxCount = fan_vtx_count;
+    item.KeyTriCount = (fan_vtx_count == 0 || key_per_tri) ? 1 : fan_vtx_count - 2;
+    item.IdxOffset = IdxBuffer.Size;
+
+    // No primitive uses the previous run, remove it
+    if (!_PrimBuffer.empty() && _PrimBuffer.back().KeyIdx == item.KeyIdx)
+        _PrimBuffer.pop_back();
+
+    // Same kind of primitives as the previous run, keep using it as long as its fans are complete
+    if (!_PrimBuffer.empty() && _PrimBuffer.back().FanVtxCount == fan_vtx_count && _PrimBuffer.back().KeyTriCount == item.KeyTriCount) {
+        const ImPrimBufferItem& prev = _PrimBuffer.back();
+        if (fan_vtx_count == 0)
+            return;
+        unsigned int vtx_count = item.VtxIdx - prev.VtxIdx;
+        unsigned int fan_count = vtx_count / (unsigned int)fan_vtx_count;
+        unsigned int keys_per_fan = (unsigned int)((fan_vtx_count - 2) / item.KeyTriCount);
+        if (vtx_count % (unsigned int)fan_vtx_count == 0 && item.KeyIdx - prev.KeyIdx == fan_count * keys_per_fan)
+            return;
+    }
+    _PrimBuffer.push_back(item);
+}
+
+void ImDrawList3D::SetSortMode(int mode) {
+    ImSortModeBufferItem item;
+    item.KeyIdx = (unsigned int)ZBuffer.Size;
+    item.Mode = mode;
+
+    // All the keys are sorted so far, nothing to record
+    if (_SortModeBuffer.empty() && mode == ImDrawList3DSortMode_Sorted)
+        return;
+
+    // No key uses the previous mode, replace it
+    if (!_SortModeBuffer.empty() && _SortModeBuffer.back().KeyIdx == item.KeyIdx)
+        _SortModeBuffer.pop_back();
+
+    // Same mode as the previous one, keep using it. Pre-sorted sequences are only ordered within themselves, so they are never joined
+    if (!_SortModeBuffer.empty() && _SortModeBuffer.back().Mode == mode && mode != ImDrawList3DSortMode_PreSorted)
+        return;
+    _SortModeBuffer.push_back(item);
+}
+
 #ifdef IMGUI_HAS_TEXTURES
 #define SET_TEX_REF(cmd, tex_ref) (cmd).TexRef = (tex_ref)
 #define GET_TEX_REF(cmd) (cmd).TexRef
@@ -3658,77 +3970,261 @@ void ImDrawList3D::ResetTexture() { SetTexture(ImTextureID(0)); }
 #define GET_TEX_REF(cmd) (cmd).TextureId
 #endif
 
-void ImDrawList3D::SortedMoveToImGuiDrawList() {
+static int IMGUI_CDECL ComparePrimSortItems(const void* a, const void* b) {
+    double za = ((const ImDrawList3D::ImPrimSortItem*)a)->Z;
+    double zb = ((const ImDrawList3D::ImPrimSortItem*)b)->Z;
+    return (za < zb) ? -1 : (za > zb) ? 1 : 0;
+}
+
+// Merges the sorted arrays #a and #b into #out. #out may overlap #b if it starts #a_count items before it
+static void MergePrimSortItems(const ImDrawList3D::ImPrimSortItem* a, int a_count, const ImDrawList3D::ImPrimSortItem* b, int b_count,
+                               ImDrawList3D::ImPrimSortItem* out) {
+    int i = 0, j = 0, k = 0;
+    while (i < a_count && j < b_count)
+        out[k++] = (b[j].Z < a[i].Z) ? b[j++] : a[i++];
+    while (i < a_count)
+        out[k++] = a[i++];
+    while (j < b_count)
+        out[k++] = b[j++];
+}
+
+// Sorts the #count primitives of #prims (in key order) by depth according to the sort modes of their keys. Unsorted keys are moved to the front
+// in submission order, and each pre-sorted sequence is merged with the sorted keys in linear time. Returns the number of keys actually sorted
+static int SortPrimsWithModes(ImDrawList3D::ImPrimSortItem* prims, int count, const ImVector<ImDrawList3D::ImSortModeBufferItem>& modes) {
+    typedef ImDrawList3D::ImPrimSortItem PrimSortItem;
+
+    // Count the keys of each mode
+    int unsorted_count = 0, sorted_count = 0, seq_count = 0;
+    int m = -1;
+    for (int i = 0; i < count; i++) {
+        const int prev_m = m;
+        while (m + 1 < modes.Size && (int)modes[m + 1].KeyIdx <= prims[i].KeyIdx)
+            m++;
+        const int mode = m < 0 ? ImDrawList3DSortMode_Sorted : modes[m].Mode;
+        if (mode == ImDrawList3DSortMode_Unsorted)
+            unsorted_count++;
+        else if (mode == ImDrawList3DSortMode_Sorted)
+            sorted_count++;
+        else if (m != prev_m || i == 0)
+            seq_count++;
+    }
+
+    // Lay the keys out as [unsorted | sorted | pre-sorted sequence 0 | sequence 1...]
+    PrimSortItem* tmp = (PrimSortItem*)ImPlot3D::FrameAlloc(sizeof(PrimSortItem) * count * 2);
+    PrimSortItem* tmp_merge = tmp + count;
+    int* seq_end = (int*)ImPlot3D::FrameAlloc(sizeof(int) * (seq_count + 1));
+    int unsorted_write = 0, sorted_write = unsorted_count, seq_write = unsorted_count + sorted_count;
+    int seq = 0;
+    m = -1;
+    for (int i = 0; i < count; i++) {
+        const int prev_m = m;
+        while (m + 1 < modes.Size && (int)modes[m + 1].KeyIdx <= prims[i].KeyIdx)
+            m++;
+        const int mode = m < 0 ? ImDrawList3DSortMode_Sorted : modes[m].Mode;
+        if (mode == ImDrawList3DSortMode_Unsorted) {
+            tmp[unsorted_write] = prims[i];
+            // Keeps them in front when merged with retained primitives
+            tmp[unsorted_write++].Z = -DBL_MAX;
+        } else if (mode == ImDrawList3DSortMode_Sorted) {
+            tmp[sorted_write++] = prims[i];
+        } else {
+            if ((m != prev_m || i == 0) && seq_write > unsorted_count + sorted_count)
+                seq_end[seq++] = seq_write;
+            tmp[seq_write++] = prims[i];
+        }
+    }
+    if (seq_count > 0)
+        seq_end[seq] = seq_write;
+
+    // Sort the sorted keys, then merge each pre-sorted sequence into them, alternating between the two halves of tmp
+    int keys_sorted = sorted_count;
+    ImQsort(tmp + unsorted_count, (size_t)sorted_count, sizeof(PrimSortItem), ComparePrimSortItems);
+    PrimSortItem* merged = tmp + unsorted_count;
+    int merged_count = sorted_count;
+    int seq_begin = unsorted_count + sorted_count;
+    for (int s = 0; s < seq_count; s++) {
+        PrimSortItem* seq_items = tmp + seq_begin;
+        const int seq_size = seq_end[s] - seq_begin;
+        bool ordered = true;
+        for (int i = 1; i < seq_size && ordered; i++)
+            ordered = seq_items[i - 1].Z <= seq_items[i].Z;
+        if (!ordered) {
+            ImQsort(seq_items, (size_t)seq_size, sizeof(PrimSortItem), ComparePrimSortItems);
+            keys_sorted += seq_size;
+        }
+        PrimSortItem* out = (merged == tmp + unsorted_count) ? tmp_merge + unsorted_count : tmp + unsorted_count;
+        MergePrimSortItems(merged, merged_count, seq_items, seq_size, out);
+        merged = out;
+        merged_count += seq_size;
+        seq_begin = seq_end[s];
+    }
+
+    memcpy(prims, tmp, sizeof(PrimSortItem) * unsorted_count);
+    memcpy(prims + unsorted_count, merged, sizeof(PrimSortItem) * merged_count);
+    return keys_sorted;
+}
+
+int ImDrawList3D::SortedMoveToImGuiDrawList(bool retain) {
     ImDrawList& draw_list = *ImGui::GetWindowDrawList();
 
-    const int tri_count = ZBuffer.Size;
-    if (tri_count == 0) {
-        // No triangles, just reset buffers and return
-        ResetBuffers();
-        return;
+    const int key_count = ZBuffer.Size;
+    if (key_count == 0) {
+        // No primitives, just reset buffers and return
+        _SortKeyCount = 0;
+        if (!retain)
+            ResetBuffers();
+        return 0;
     }
 
-    // Build an array of (z, tri_idx)
-    struct TriRef {
-        double z;
-        int tri_idx;
-    };
-    TriRef* tris = (TriRef*)IM_ALLOC(sizeof(TriRef) * tri_count);
-    for (int i = 0; i < tri_count; i++) {
-        tris[i].z = ZBuffer[i];
-        tris[i].tri_idx = i;
+    // Triangles added before the first call to SetPrimFan have explicit indices
+    if (_PrimBuffer.empty() || _PrimBuffer[0].KeyIdx != 0) {
+        ImPrimBufferItem item = {0, 0, 0, 1, 0};
+        _PrimBuffer.push_front(item);
+    }
+
+    // Count the triangles of all the runs
+    int tri_count = 0;
+    for (int r = 0; r < _PrimBuffer.Size; r++) {
+        const int run_end = r + 1 < _PrimBuffer.Size ? (int)_PrimBuffer[r + 1].KeyIdx : key_count;
+        tri_count += (run_end - (int)_PrimBuffer[r].KeyIdx) * _PrimBuffer[r].KeyTriCount;
+    }
+
+    // Build an array of (z, key_idx, run), one per primitive. The run index fits in the padding of the struct. Retained primitives were
+    // already sorted by a previous call, only the new ones need to be added
+    const int sorted_count = retain ? _SortBuffer.Size : 0;
+    ImPrimSortItem* prims;
+    if (retain) {
+        _SortBuffer.resize(key_count);
+        prims = _SortBuffer.Data;
+    } else {
+        prims = (ImPrimSortItem*)ImPlot3D::FrameAlloc(sizeof(ImPrimSortItem) * key_count);
+    }
+    int run = 0;
+    for (int i = sorted_count; i < key_count; i++) {
+        while (run + 1 < _PrimBuffer.Size && (int)_PrimBuffer[run + 1].KeyIdx <= i)
+            run++;
+        prims[i].Z = ZBuffer[i];
+        prims[i].KeyIdx = i;
+        prims[i].Run = run;
     }
 
     // Sort by z (distance from viewer)
-    ImQsort(tris, (size_t)tri_count, sizeof(TriRef), [](const void* a, const void* b) {
-        double za = ((const TriRef*)a)->z;
-        double zb = ((const TriRef*)b)->z;
-        return (za < zb) ? -1 : (za > zb) ? 1 : 0;
-    });
+    if (_SortModeBuffer.empty()) {
+        _SortKeyCount = key_count - sorted_count;
+        ImQsort(prims + sorted_count, (size_t)_SortKeyCount, sizeof(ImPrimSortItem), ComparePrimSortItems);
+    } else {
+        _SortKeyCount = SortPrimsWithModes(prims + sorted_count, key_count - sorted_count, _SortModeBuffer);
+    }
 
-    // Reserve space in the ImGui draw list
-    draw_list.PrimReserve(IdxBuffer.Size, VtxBuffer.Size);
+    // Merge the new primitives with the retained ones, starting from the back so that it can be done in place
+    if (sorted_count > 0 && sorted_count < key_count) {
+        const int new_count = key_count - sorted_count;
+        ImPrimSortItem* new_prims = (ImPrimSortItem*)ImPlot3D::FrameAlloc(sizeof(ImPrimSortItem) * new_count);
+        memcpy(new_prims, prims + sorted_count, sizeof(ImPrimSortItem) * new_count);
+        int i = sorted_count - 1;
+        int j = new_count - 1;
+        for (int k = key_count - 1; j >= 0; k--)
+            prims[k] = (i >= 0 && prims[i].Z > new_prims[j].Z) ? prims[i--] : new_prims[j--];
+    }
 
-    // Copy vertices (no reordering needed)
-    memcpy(draw_list._VtxWritePtr, VtxBuffer.Data, VtxBuffer.Size * sizeof(ImDrawVert));
+    // Reserve space in the ImGui draw list
+    draw_list.PrimReserve(tri_count * 3, PosBuffer.Size);
+
+    // Build the vertices from their positions and styles (no reordering needed)
+    IM_ASSERT(_VtxStyleBuffer.Size > 0 && _VtxStyleBuffer[0].VtxIdx == 0 && "Vertices were added before calling SetVtxStyle()!");
+    ImDrawVert* vtx_out = draw_list._VtxWritePtr;
+    for (int s = 0; s < _VtxStyleBuffer.Size; s++) {
+        const ImVtxStyleBufferItem& style = _VtxStyleBuffer[s];
+        const int vtx_begin = (int)style.VtxIdx;
+        const int vtx_end = s + 1 < _VtxStyleBuffer.Size ? (int)_VtxStyleBuffer[s + 1].VtxIdx : PosBuffer.Size;
+        const unsigned int uv_mask = (unsigned int)style.UVCount - 1;
+        const ImVec2* pos_in = PosBuffer.Data + vtx_begin;
+        if (style.ColOffset == -1) {
+            for (int i = 0; i < vtx_end - vtx_begin; i++) {
+                vtx_out[i].pos = pos_in[i];
+                vtx_out[i].uv = style.UV[i & uv_mask];
+                vtx_out[i].col = style.Col;
+            }
+        } else {
+            const ImU32* col_in = ColBuffer.Data + style.ColOffset;
+            for (int i = 0; i < vtx_end - vtx_begin; i++) {
+                vtx_out[i].pos = pos_in[i];
+                vtx_out[i].uv = style.UV[i & uv_mask];
+                vtx_out[i].col = col_in[i];
+            }
+        }
+        vtx_out += vtx_end - vtx_begin;
+    }
     unsigned int idx_offset = draw_list._VtxCurrentIdx;
-    draw_list._VtxWritePtr += VtxBuffer.Size;
-    draw_list._VtxCurrentIdx += (unsigned int)VtxBuffer.Size;
+    draw_list._VtxWritePtr += PosBuffer.Size;
+    draw_list._VtxCurrentIdx += (unsigned int)PosBuffer.Size;
 
     // Maximum index allowed to not overflow ImDrawIdx
     unsigned int max_index_allowed = MaxIdx() - idx_offset;
 
-    // Copy indices with triangle sorting based on distance from viewer
+    // Write indices with primitive sorting based on distance from viewer. Triangles of fan runs get their indices generated from the
+    // position of the primitive in the run, the others read them from IdxBuffer
     ImDrawIdx* idx_out_begin = draw_list._IdxWritePtr;
     ImDrawIdx* idx_out = idx_out_begin;
-    ImDrawIdx* idx_in = IdxBuffer.Data;
-    for (int i = 0; i < tri_count; i++) {
-        int tri_i = tris[i].tri_idx;
-        int base_idx = tri_i * 3;
-        unsigned int i0 = (unsigned int)idx_in[base_idx + 0];
-        unsigned int i1 = (unsigned int)idx_in[base_idx + 1];
-        unsigned int i2 = (unsigned int)idx_in[base_idx + 2];
-
-        // Check if after adding offset any of these indices exceed max_index_allowed
-        if (i0 > max_index_allowed || i1 > max_index_allowed || i2 > max_index_allowed)
+    for (int i = 0; i < key_count; i++) {
+        const ImPrimBufferItem& prim_run = _PrimBuffer[prims[i].Run];
+        const unsigned int local_idx = (unsigned int)prims[i].KeyIdx - prim_run.KeyIdx;
+        if (prim_run.FanVtxCount == 0) {
+            const ImDrawIdx* idx_in = IdxBuffer.Data + prim_run.IdxOffset + local_idx * 3;
+            unsigned int i0 = (unsigned int)idx_in[0];
+            unsigned int i1 = (unsigned int)idx_in[1];
+            unsigned int i2 = (unsigned int)idx_in[2];
+
+            // Check if after adding offset any of these indices exceed max_index_allowed
+            if (i0 > max_index_allowed || i1 > max_index_allowed || i2 > max_index_allowed)
+                continue;
+
+            idx_out[0] = (ImDrawIdx)(i0 + idx_offset);
+            idx_out[1] = (ImDrawIdx)(i1 + idx_offset);
+            idx_out[2] = (ImDrawIdx)(i2 + idx_offset);
+            idx_out += 3;
             continue;
+        }
 
-        idx_out[0] = (ImDrawIdx)(i0 + idx_offset);
-        idx_out[1] = (ImDrawIdx)(i1 + idx_offset);
-        idx_out[2] = (ImDrawIdx)(i2 + idx_offset);
+        // Find the fan and the first triangle of the key within the fan
+        const unsigned int fan_vtx_count = (unsigned int)prim_run.FanVtxCount;
+        const unsigned int fan_tri_count = fan_vtx_count - 2;
+        const unsigned int key_tri_count = (unsigned int)prim_run.KeyTriCount;
+        unsigned int fan_idx = local_idx;
+        unsigned int first_tri = 0;
+        if (key_tri_count != fan_tri_count) {
+            fan_idx = local_idx * key_tri_count / fan_tri_count;
+            first_tri = local_idx * key_tri_count - fan_idx * fan_tri_count;
+        }
+        const unsigned int i0 = prim_run.VtxIdx + fan_idx * fan_vtx_count;
+
+        // Check if after adding offset the last vertex of the triangles exceeds max_index_allowed
+        if (i0 + first_tri + key_tri_count + 1 > max_index_allowed)
+            continue;
 
-        idx_out += 3;
+        for (unsigned int t = first_tri; t < first_tri + key_tri_count; t++) {
+            idx_out[0] = (ImDrawIdx)(i0 + idx_offset);
+            idx_out[1] = (ImDrawIdx)(i0 + t + 1 + idx_offset);
+            idx_out[2] = (ImDrawIdx)(i0 + t + 2 + idx_offset);
+            idx_out += 3;
+        }
     }
     ImDrawIdx* idx_out_end = idx_out;
     draw_list._IdxWritePtr = idx_out_end;
 
+    // Give back the indices reserved for dropped triangles
+    const int idx_written = (int)(idx_out_end - idx_out_begin);
+    const int idx_dropped = tri_count * 3 - idx_written;
+    if (idx_dropped > 0)
+        draw_list.PrimUnreserve(idx_dropped, 0);
+
     // If multiple textures were used (e.g. PlotImage was called), generate multiple ImDrawCmd
     if (_TextureBuffer.Size > 1) {
         ImTextureRef default_tex = GET_TEX_REF(draw_list._CmdHeader);
         ImTextureRef curr_tex = default_tex;
 
         // Remove elements reserved from PrimReserve
-        draw_list.CmdBuffer.back().ElemCount -= IdxBuffer.Size;
+        draw_list.CmdBuffer.back().ElemCount -= (unsigned int)idx_written;
         ImDrawIdx* last_cmd_buffer_idx = idx_out_begin;
 
         // For each triangle added to the draw_list
@@ -3766,7 +4262,7 @@ void ImDrawList3D::SortedMoveToImGuiDrawList() {
             }
         }
         // Flush last elements to cmd buffer
-        draw_list.CmdBuffer.back().ElemCount += (unsigned int)(&draw_list.IdxBuffer.back() - last_cmd_buffer_idx + 1);
+        draw_list.CmdBuffer.back().ElemCount += (unsigned int)(idx_out_end - last_cmd_buffer_idx);
 
         // Check if the last texture was not the default texture
         if (curr_tex != default_tex) {
@@ -3779,9 +4275,48 @@ void ImDrawList3D::SortedMoveToImGuiDrawList() {
     }
 
     // Reset buffers since we've moved them
-    ResetBuffers();
+    if (!retain)
+        ResetBuffers();
 
-    IM_FREE(tris);
+    return idx_dropped / 3;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DFrameArena
+//-----------------------------------------------------------------------------
+
+ImPlot3DFrameArena::~ImPlot3DFrameArena() {
+    Reset();
+    IM_FREE(Data);
+}
+
+void* ImPlot3DFrameArena::Alloc(size_t size) {
+    if (AllocFunc != nullptr)
+        return AllocFunc(size, UserData);
+    size = (size + 15) & ~(size_t)15;
+    const size_t offset = Used;
+    Used += size;
+    if (Used <= Capacity)
+        return Data + offset;
+    // Out of arena memory, fall back to the heap until the next reset
+    void* ptr = IM_ALLOC(size);
+    Overflow.push_back(ptr);
+    return ptr;
+}
+
+void ImPlot3DFrameArena::Reset() {
+    if (ResetFunc != nullptr)
+        ResetFunc(UserData);
+    for (int i = 0; i < Overflow.Size; i++)
+        IM_FREE(Overflow[i]);
+    Overflow.shrink(0);
+    // Grow to fit everything allocated during the last frame
+    if (Used > Capacity) {
+        IM_FREE(Data);
+        Capacity = Used + Used / 2;
+        Data = (char*)IM_ALLOC(Capacity);
+    }
+    Used = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -3859,6 +4394,66 @@ void ImPlot3DPlot::ApplyEqualAspect(ImAxis3D ref_axis) {
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DProgressive
+//-----------------------------------------------------------------------------
+
+ImPlot3DProgressiveCall& ImPlot3DProgressive::NextCall(ImGuiID item_id, int data_version, int count) {
+    ImGuiID id = ImHashData(&data_version, sizeof(int), item_id);
+    id = ImHashData(&count, sizeof(int), id);
+    id = ImHashData(&CallIdx, sizeof(int), id);
+    if (CallIdx == Calls.Size) {
+        ImPlot3DProgressiveCall call;
+        call.ID = 0;
+        Calls.push_back(call);
+    }
+    ImPlot3DProgressiveCall& call = Calls[CallIdx++];
+    if (call.ID != id) {
+        // New call, or its data changed. Its previous geometry can't be removed from the draw list, so restart on the next frame
+        if (call.ID != 0)
+            Restart = true;
+        call.ID = id;
+        call.Count = count;
+        call.Done = 0;
+        call.Pass = 0;
+        call.Next = 0;
+        // Make the first pass fit in the budget share of the call
+        const int budget = ImMax(GetCallBudget(call), 1);
+        call.Stride = ImClamp((count + budget - 1) / budget, 1, 64);
+    }
+    return call;
+}
+
+int ImPlot3DProgressive::GetCallBudget(const ImPlot3DProgressiveCall& call) const {
+    int budget = PrimsLeft;
+    if (PrimCount > call.Count)
+        budget = ImMin(budget, (int)ImMax(1.0, (double)PrimBudget * call.Count / PrimCount));
+    return ImMin(budget, call.Count - call.Done);
+}
+
+bool ImPlot3DProgressive::IsOutOfTime() const {
+    return TimeBudget > 0.0 && ImPlot3D::GetTimeMs() - StartTime > TimeBudget;
+}
+
+float ImPlot3DProgressive::GetProgress() const {
+    double done = 0.0, count = 0.0;
+    for (int i = 0; i < Calls.Size; i++) {
+        done += Calls[i].Done;
+        count += Calls[i].Count;
+    }
+    return count > 0.0 ? (float)(done / count) : 1.0f;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DHeatmap
+//-----------------------------------------------------------------------------
+
+ImPlot3DHeatmap::~ImPlot3DHeatmap() {
+#ifdef IMGUI_HAS_TEXTURES
+    ImPlot3D::DestroyItemTexture(Texture);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DStyle
 //-----------------------------------------------------------------------------
@@ -4145,6 +4740,21 @@ void ImPlot3D::ShowMetricsWindow(bool* p_popen) {
                     ImGui::TreePop();
                 }
 
+                if (ImGui::TreeNode("Stats")) {
+                    ImGui::BulletText("PrimsRendered: %d", plot.Stats.PrimsRendered);
+                    ImGui::BulletText("PrimsCulled: %d", plot.Stats.PrimsCulled);
+                    ImGui::BulletText("PrimsUnclipped: %d", plot.Stats.PrimsUnclipped);
+                    ImGui::BulletText("PrimsDropped: %d", plot.Stats.PrimsDropped);
+                    ImGui::BulletText("TrisDropped: %d", plot.Stats.TrisDropped);
+                    ImGui::BulletText("VtxCount: %d", plot.Stats.VtxCount);
+                    ImGui::BulletText("TriCount: %d", plot.Stats.TriCount);
+                    ImGui::BulletText("SortKeyCount: %d", plot.Stats.SortKeyCount);
+                    ImGui::BulletText("PointsRequested: %d", plot.Stats.PointsRequested);
+                    ImGui::BulletText("TrisRequested: %d", plot.Stats.TrisRequested);
+                    ImGui::BulletText("SortTime: %.3f ms", plot.Stats.SortTime);
+                    ImGui::TreePop();
+                }
+
                 ImGui::BulletText("Title: %s", plot.HasTitle() ? plot.GetTitle() : "none");
                 ImGui::BulletText("Flags: 0x%08X", plot.Flags);
                 ImGui::BulletText("Initialized: %s", plot.Initialized ? "true" : "false");
@@ -29,6 +29,7 @@
 // [SECTION] ImPlot3DPlane
 // [SECTION] ImPlot3DBox
 // [SECTION] ImPlot3DQuat
+// [SECTION] ImPlot3DModelTransform
 // [SECTION] ImPlot3DStyle
 // [SECTION] Meshes
 // [SECTION] Obsolete API
@@ -64,6 +65,8 @@ struct ImPlot3DPlane;
 struct ImPlot3DBox;
 struct ImPlot3DRange;
 struct ImPlot3DQuat;
+struct ImPlot3DModelTransform;
+struct ImDrawList3D;
 
 // Enums
 typedef int ImPlot3DCond;     // -> ImPlot3DCond_              // Enum: Condition for flags
@@ -78,18 +81,22 @@ typedef int ImPlot3DColormap; // -> ImPlot3DColormap_          // Enum: Colormap
 typedef int ImPlot3DProp;     // -> ImPlot3DProp_              // Enum: Plot properties
 
 // Flags
-typedef int ImPlot3DFlags;         // -> ImPlot3DFlags_         // Flags: for BeginPlot()
-typedef int ImPlot3DItemFlags;     // -> ImPlot3DItemFlags_     // Flags: Item flags
-typedef int ImPlot3DScatterFlags;  // -> ImPlot3DScatterFlags_  // Flags: Scatter plot flags
-typedef int ImPlot3DLineFlags;     // -> ImPlot3DLineFlags_     // Flags: Line plot flags
-typedef int ImPlot3DTriangleFlags; // -> ImPlot3DTriangleFlags_ // Flags: Triangle plot flags
-typedef int ImPlot3DQuadFlags;     // -> ImPlot3DQuadFlags_     // Flags: Quad plot flags
-typedef int ImPlot3DSurfaceFlags;  // -> ImPlot3DSurfaceFlags_  // Flags: Surface plot flags
-typedef int ImPlot3DMeshFlags;     // -> ImPlot3DMeshFlags_     // Flags: Mesh plot flags
-typedef int ImPlot3DImageFlags;    // -> ImPlot3DImageFlags_    // Flags: Image plot flags
-typedef int ImPlot3DDummyFlags;    // -> ImPlot3DDummyFlags_    // Flags: Dummy flags
-typedef int ImPlot3DLegendFlags;   // -> ImPlot3DLegendFlags_   // Flags: Legend flags
-typedef int ImPlot3DAxisFlags;     // -> ImPlot3DAxisFlags_     // Flags: Axis flags
+typedef int ImPlot3DFlags;          // -> ImPlot3DFlags_          // Flags: for BeginPlot()
+typedef int ImPlot3DItemFlags;      // -> ImPlot3DItemFlags_      // Flags: Item flags
+typedef int ImPlot3DScatterFlags;   // -> ImPlot3DScatterFlags_   // Flags: Scatter plot flags
+typedef int ImPlot3DLineFlags;      // -> ImPlot3DLineFlags_      // Flags: Line plot flags
+typedef int ImPlot3DTriangleFlags;  // -> ImPlot3DTriangleFlags_  // Flags: Triangle plot flags
+typedef int ImPlot3DQuadFlags;      // -> ImPlot3DQuadFlags_      // Flags: Quad plot flags
+typedef int ImPlot3DSurfaceFlags;   // -> ImPlot3DSurfaceFlags_   // Flags: Surface plot flags
+typedef int ImPlot3DWaterfallFlags; // -> ImPlot3DWaterfallFlags_ // Flags: Waterfall plot flags
+typedef int ImPlot3DHeatmapFlags;   // -> ImPlot3DHeatmapFlags_   // Flags: Heatmap plot flags
+typedef int ImPlot3DMeshFlags;      // -> ImPlot3DMeshFlags_      // Flags: Mesh plot flags
+typedef int ImPlot3DTubeFlags;      // -> ImPlot3DTubeFlags_      // Flags: Tube plot flags
+typedef int ImPlot3DImageFlags;     // -> ImPlot3DImageFlags_     // Flags: Image plot flags
+typedef int ImPlot3DDummyFlags;     // -> ImPlot3DDummyFlags_     // Flags: Dummy flags
+typedef int ImPlot3DTextFlags;      // -> ImPlot3DTextFlags_      // Flags: Text flags (PlotTexts)
+typedef int ImPlot3DLegendFlags;    // -> ImPlot3DLegendFlags_    // Flags: Legend flags
+typedef int ImPlot3DAxisFlags;      // -> ImPlot3DAxisFlags_      // Flags: Axis flags
 
 // Fallback for ImGui versions before v1.92: define ImTextureRef as ImTextureID
 // You can `#define IMPLOT3D_NO_IMTEXTUREREF` to avoid this fallback
@@ -113,22 +120,27 @@ enum ImPlot3DProp_ {
     ImPlot3DProp_MarkerFillColor, // Marker fill color; IMPLOT3D_AUTO_COL will use LineColor
     ImPlot3DProp_Offset,          // Data index offset
     ImPlot3DProp_Stride,          // Data stride in bytes; IMPLOT3D_AUTO will result in sizeof(T) where T is the type passed to PlotX
-    ImPlot3DProp_Flags            // Optional item flags; can be composed from common ImPlot3DItemFlags and/or specialized ImPlot3DXFlags
+    ImPlot3DProp_Flags,           // Optional item flags; can be composed from common ImPlot3DItemFlags and/or specialized ImPlot3DXFlags
+    ImPlot3DProp_DataVersion,     // Data version; when >= 0, values derived from the data are cached until it changes
+    ImPlot3DProp_Bounds,          // Optional bounds of the data in plot coordinates (const ImPlot3DBox*), to cull the whole item at once
+    ImPlot3DProp_ModelTransform,  // Optional model transform of the vertices (const ImPlot3DModelTransform*), PlotMesh only
 };
 
 // Flags for ImPlot3D::BeginPlot()
 enum ImPlot3DFlags_ {
-    ImPlot3DFlags_None = 0,             // Default
-    ImPlot3DFlags_NoTitle = 1 << 0,     // Hide plot title
-    ImPlot3DFlags_NoLegend = 1 << 1,    // Hide plot legend
-    ImPlot3DFlags_NoMouseText = 1 << 2, // Hide mouse position in plot coordinates
-    ImPlot3DFlags_NoClip = 1 << 3,      // Disable 3D box clipping
-    ImPlot3DFlags_NoMenus = 1 << 4,     // The user will not be able to open context menus
-    ImPlot3DFlags_Equal = 1 << 5,       // X, Y, and Z axes will be constrained to have the same units/pixel
-    ImPlot3DFlags_NoRotate = 1 << 6,    // Lock rotation interaction
-    ImPlot3DFlags_NoPan = 1 << 7,       // Lock panning/translation interaction
-    ImPlot3DFlags_NoZoom = 1 << 8,      // Lock zoom interaction
-    ImPlot3DFlags_NoInputs = 1 << 9,    // Disable all user inputs
+    ImPlot3DFlags_None = 0,                 // Default
+    ImPlot3DFlags_NoTitle = 1 << 0,         // Hide plot title
+    ImPlot3DFlags_NoLegend = 1 << 1,        // Hide plot legend
+    ImPlot3DFlags_NoMouseText = 1 << 2,     // Hide mouse position in plot coordinates
+    ImPlot3DFlags_NoClip = 1 << 3,          // Disable 3D box clipping
+    ImPlot3DFlags_NoMenus = 1 << 4,         // The user will not be able to open context menus
+    ImPlot3DFlags_Equal = 1 << 5,           // X, Y, and Z axes will be constrained to have the same units/pixel
+    ImPlot3DFlags_NoRotate = 1 << 6,        // Lock rotation interaction
+    ImPlot3DFlags_NoPan = 1 << 7,           // Lock panning/translation interaction
+    ImPlot3DFlags_NoZoom = 1 << 8,          // Lock zoom interaction
+    ImPlot3DFlags_NoInputs = 1 << 9,        // Disable all user inputs
+    ImPlot3DFlags_InteractiveLOD = 1 << 10, // Render a subset of the data while the plot is rotated or panned (see SetupInteractiveLOD)
+    ImPlot3DFlags_Progressive = 1 << 11,    // Spread the geometry generation over several frames while the view doesn't change (see SetupProgressive)
     ImPlot3DFlags_CanvasOnly = ImPlot3DFlags_NoTitle | ImPlot3DFlags_NoLegend | ImPlot3DFlags_NoMouseText,
 };
 
@@ -195,9 +207,15 @@ enum ImPlot3DMarker_ {
 
 // Flags for items
 enum ImPlot3DItemFlags_ {
-    ImPlot3DItemFlags_None = 0,          // Default
-    ImPlot3DItemFlags_NoLegend = 1 << 0, // The item won't have a legend entry displayed
-    ImPlot3DItemFlags_NoFit = 1 << 1,    // The item won't be considered for plot fits
+    ImPlot3DItemFlags_None = 0,               // Default
+    ImPlot3DItemFlags_NoLegend = 1 << 0,      // The item won't have a legend entry displayed
+    ImPlot3DItemFlags_NoFit = 1 << 1,         // The item won't be considered for plot fits
+    ImPlot3DItemFlags_SpriteMarkers = 1 << 2, // Markers are rendered as one textured quad each, using sprites stored in the font atlas (requires
+                                              // Dear ImGui 1.92+ and a renderer backend supporting dynamic textures, otherwise ignored)
+    ImPlot3DItemFlags_NoDepthSort = 1 << 3,   // The item is not depth sorted, it is drawn behind the sorted items in submission order (e.g.
+                                              // backgrounds)
+    ImPlot3DItemFlags_PreSorted = 1 << 4,     // The item's data is already ordered back to front for the current view, so its primitives are merged
+                                              // with the sorted ones instead of being sorted (they are sorted anyway if the order doesn't hold)
 };
 
 // Flags for PlotScatter
@@ -245,6 +263,24 @@ enum ImPlot3DSurfaceFlags_ {
     ImPlot3DSurfaceFlags_NoLines = 1 << 10,   // No lines will be rendered
     ImPlot3DSurfaceFlags_NoFill = 1 << 11,    // No fill will be rendered
     ImPlot3DSurfaceFlags_NoMarkers = 1 << 12, // No markers will be rendered
+    ImPlot3DSurfaceFlags_RowOffset = 1 << 13, // ImPlot3DSpec::Offset counts whole rows of x_count values, for grids stored as a ring of rows
+};
+
+// Flags for PlotWaterfall
+enum ImPlot3DWaterfallFlags_ {
+    ImPlot3DWaterfallFlags_None = 0, // Default
+    ImPlot3DWaterfallFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
+    ImPlot3DWaterfallFlags_NoFit = ImPlot3DItemFlags_NoFit,
+    ImPlot3DWaterfallFlags_NoLines = 1 << 10,   // No lines will be rendered
+    ImPlot3DWaterfallFlags_NoFill = 1 << 11,    // No fill will be rendered
+    ImPlot3DWaterfallFlags_NoMarkers = 1 << 12, // No markers will be rendered
+};
+
+// Flags for PlotHeatmap3D
+enum ImPlot3DHeatmapFlags_ {
+    ImPlot3DHeatmapFlags_None = 0, // Default
+    ImPlot3DHeatmapFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
+    ImPlot3DHeatmapFlags_NoFit = ImPlot3DItemFlags_NoFit,
 };
 
 // Flags for PlotMesh
@@ -257,6 +293,15 @@ enum ImPlot3DMeshFlags_ {
     ImPlot3DMeshFlags_NoMarkers = 1 << 12, // No markers will be rendered
 };
 
+// Flags for PlotTube
+enum ImPlot3DTubeFlags_ {
+    ImPlot3DTubeFlags_None = 0, // Default
+    ImPlot3DTubeFlags_NoLegend = ImPlot3DItemFlags_NoLegend,
+    ImPlot3DTubeFlags_NoFit = ImPlot3DItemFlags_NoFit,
+    ImPlot3DTubeFlags_Ribbon = 1 << 10,    // A flat ribbon of width 2 * radius is swept along the path instead of a circular tube
+    ImPlot3DTubeFlags_NoShading = 1 << 11, // The fill color is used as is instead of being darkened towards the silhouette
+};
+
 // Flags for PlotImage
 enum ImPlot3DImageFlags_ {
     ImPlot3DImageFlags_None = 0, // Default
@@ -269,6 +314,13 @@ enum ImPlot3DDummyFlags_ {
     ImPlot3DDummyFlags_None = 0 // Default
 };
 
+// Flags for PlotTexts
+enum ImPlot3DTextFlags_ {
+    ImPlot3DTextFlags_None = 0,             // Default
+    ImPlot3DTextFlags_NoCollision = 1 << 0, // Draw every label, even the ones overlapping other labels
+    ImPlot3DTextFlags_DepthSort = 1 << 1,   // Sort the labels with the plot geometry, so that geometry in front of a label hides it
+};
+
 // Flags for legends
 enum ImPlot3DLegendFlags_ {
     ImPlot3DLegendFlags_None = 0,                 // Default
@@ -386,6 +438,11 @@ struct ImPlot3DSpec {
     int Stride = IMPLOT3D_AUTO;                  // Data stride in bytes; IMPLOT3D_AUTO will result in sizeof(T) where T is the type passed to PlotX
     ImPlot3DItemFlags Flags =
         ImPlot3DItemFlags_None; // Optional item flags; can be composed from common ImPlot3DItemFlags and/or specialized ImPlot3DXFlags
+    int DataVersion = -1; // Data version; when >= 0, values derived from the data (e.g. log/symlog scaled coordinates) are cached until it changes
+    const ImPlot3DBox* Bounds = nullptr; // Optional bounds of the data in plot coordinates; items fully inside or outside the plot box then skip
+                                         // per-primitive culling. If not set, bounds are computed during fits and cached with the data version
+    const ImPlot3DModelTransform* ModelTransform = nullptr; // Optional transform from the vertices to plot coordinates, PlotMesh only. Moving
+                                                            // a rigid mesh then only needs a new transform instead of new vertices
 
     ImPlot3DSpec() {}
 
@@ -418,6 +475,7 @@ struct ImPlot3DSpec {
             case ImPlot3DProp_Offset: Offset = (int)v; return;
             case ImPlot3DProp_Stride: Stride = (int)v; return;
             case ImPlot3DProp_Flags: Flags = (ImPlot3DItemFlags)v; return;
+            case ImPlot3DProp_DataVersion: DataVersion = (int)v; return;
             default: break;
         }
         IM_ASSERT(0 && "User provided an ImPlot3DProp which cannot be set from scalar value!");
@@ -434,6 +492,26 @@ struct ImPlot3DSpec {
         }
         IM_ASSERT(0 && "User provided an ImPlot3DProp which cannot be set from ImVec4 value!");
     }
+
+    // Set a property from an ImPlot3DBox pointer.
+    void SetProp(ImPlot3DProp prop, const ImPlot3DBox* v) {
+        if (prop == ImPlot3DProp_Bounds) {
+            Bounds = v;
+            return;
+        }
+        IM_ASSERT(0 && "User provided an ImPlot3DProp which cannot be set from ImPlot3DBox pointer!");
+    }
+    void SetProp(ImPlot3DProp prop, ImPlot3DBox* v) { SetProp(prop, (const ImPlot3DBox*)v); }
+
+    // Set a property from an ImPlot3DModelTransform pointer.
+    void SetProp(ImPlot3DProp prop, const ImPlot3DModelTransform* v) {
+        if (prop == ImPlot3DProp_ModelTransform) {
+            ModelTransform = v;
+            return;
+        }
+        IM_ASSERT(0 && "User provided an ImPlot3DProp which cannot be set from ImPlot3DModelTransform pointer!");
+    }
+    void SetProp(ImPlot3DProp prop, ImPlot3DModelTransform* v) { SetProp(prop, (const ImPlot3DModelTransform*)v); }
 };
 
 //-----------------------------------------------------------------------------
@@ -448,6 +526,13 @@ typedef int (*ImPlot3DFormatter)(double value, char* buff, int size, void* user_
 // Callback signature for axis transform
 typedef double (*ImPlot3DTransform)(double value, void* user_data);
 
+// Callback signature for batched axis transform. Transforms #count #values into #out (which may be the same array as #values)
+typedef void (*ImPlot3DTransformBatch)(const double* values, double* out, int count, void* user_data);
+
+// Callback signatures for the per-frame allocator (see SetFrameAllocatorFunctions)
+typedef void* (*ImPlot3DFrameAllocFunc)(size_t size, void* user_data);
+typedef void (*ImPlot3DFrameResetFunc)(void* user_data);
+
 namespace ImPlot3D {
 
 //-----------------------------------------------------------------------------
@@ -462,6 +547,10 @@ IMPLOT3D_API void DestroyContext(ImPlot3DContext* ctx = nullptr);
 IMPLOT3D_API ImPlot3DContext* GetCurrentContext();
 // Sets the current ImPlot3D context
 IMPLOT3D_API void SetCurrentContext(ImPlot3DContext* ctx);
+// Sets the allocator of the current context used for transient allocations (e.g. the depth sorting scratch buffer). Memory returned by
+// #alloc_func must stay valid until #reset_func is called, which happens at the first BeginPlot of each ImGui frame. By default an internal
+// arena is used, which only allocates when a frame needs more memory than the previous ones. Pass nullptr to restore it
+IMPLOT3D_API void SetFrameAllocatorFunctions(ImPlot3DFrameAllocFunc alloc_func, ImPlot3DFrameResetFunc reset_func, void* user_data = nullptr);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Begin/End Plot
@@ -536,6 +625,10 @@ IMPLOT3D_API void SetupAxisScale(ImAxis3D axis, ImPlot3DScale scale);
 // Sets an axis' scale using user supplied forward and inverse transforms
 IMPLOT3D_API void SetupAxisScale(ImAxis3D axis, ImPlot3DTransform forward, ImPlot3DTransform inverse, void* data = nullptr);
 
+// Same as above, with an optional #forward_batch transform used when many values are transformed at once (e.g. cached item coordinates)
+IMPLOT3D_API void SetupAxisScale(ImAxis3D axis, ImPlot3DTransform forward, ImPlot3DTransform inverse, void* data,
+                                 ImPlot3DTransformBatch forward_batch);
+
 // Sets an axis' limits constraints. The axis will be constrained to never go below #v_min or above #v_max
 IMPLOT3D_API void SetupAxisLimitsConstraints(ImAxis3D axis, double v_min, double v_max);
 
@@ -567,6 +660,18 @@ IMPLOT3D_API void SetupBoxInitialRotation(ImPlot3DQuat rotation);
 // Sets the plot box X/Y/Z scale. A scale of 1.0 is the default. Values greater than 1.0 enlarge the plot, while values between 0.0 and 1.0 shrink it
 IMPLOT3D_API void SetupBoxScale(double x, double y, double z);
 
+// Sets the maximum number of points (markers) and triangles (lines and fills) rendered while the plot is rotated or panned with
+// ImPlot3DFlags_InteractiveLOD. Items are decimated evenly to fit the budgets, and full quality returns when the interaction ends. Defaults to
+// 100000 points and 400000 triangles. PlotScatter, PlotLine, PlotTriangle, PlotQuad, PlotSurface and PlotMesh follow the budgets, while
+// PlotMeshInstanced, PlotTube, PlotWaterfall, PlotHeatmap3D, PlotImage and PlotText(s) are always rendered in full and not counted in them
+IMPLOT3D_API void SetupInteractiveLOD(int point_budget, int triangle_budget);
+
+// Sets the maximum number of primitives (points, line segments, triangles, quads...) generated per frame with ImPlot3DFlags_Progressive, and
+// optionally the time in milliseconds spent generating them (0 for no time limit). The first frame draws a coarse subset of every item, and the
+// next frames keep refining the retained geometry while the rotation, axis ranges and item data versions don't change. Items must set
+// ImPlot3DSpec::DataVersion, otherwise the plot is rendered in full every frame. Defaults to 200000 primitives and no time limit
+IMPLOT3D_API void SetupProgressive(int prim_budget, double time_budget_ms = 0.0);
+
 // Sets up the plot legend location and flags
 IMPLOT3D_API void SetupLegend(ImPlot3DLocation location, ImPlot3DLegendFlags flags = 0);
 
@@ -605,22 +710,81 @@ IMPLOT3D_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, co
 // Plots a line in 3D. Consecutive points are connected with line segments
 IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec = ImPlot3DSpec());
 
+// Plots a line in 3D colored by a scalar value per point (e.g. time or speed) through the current colormap, interpolated along each segment.
+// Leave #scale_min and #scale_max both at 0 for automatic color scaling, or set them to a predefined range. The alpha of the line color applies
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                           double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots a line in 3D with one color per point in #colors, interpolated along each segment. The colors follow spec.Offset like the coordinates,
+// but not spec.Stride
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImU32* colors,
+                           const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots a tube of #radius (in plot units) swept along the path xs,ys,zs, or a flat ribbon with ImPlot3DTubeFlags_Ribbon. Unlike a thick line, the
+// tube is made of depth sorted triangles shaded by their orientation. The cross-sections follow parallel-transport frames, which are cached with
+// spec.DataVersion, and the number of sides follows the projected radius, so rotating the plot reuses the geometry
+IMPLOT3D_TMP void PlotTube(const char* label_id, const T* xs, const T* ys, const T* zs, int count, double radius,
+                           const ImPlot3DSpec& spec = ImPlot3DSpec());
+
 // Plots triangles in 3D. Every 3 consecutive points define a triangle
 IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec = ImPlot3DSpec());
 
+// Plots triangles in 3D with the fill colormapped by a scalar value per vertex (e.g. temperature or stress), interpolated across each triangle.
+// Leave #scale_min and #scale_max both at 0 for automatic color scaling, or set them to a predefined range
+IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min = 0.0,
+                               double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
 // Plots quads in 3D. Every 4 consecutive points define a quadrilateral
 IMPLOT3D_TMP void PlotQuad(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec = ImPlot3DSpec());
 
 // Plot the surface defined by a grid of vertices. The grid is defined by the x and y arrays, and the z array contains the height of each vertex. A
 // total of x_count * y_count vertices are expected for each array. Leave #scale_min and #scale_max both at 0 for automatic color scaling, or set them
-// to a predefined range
+// to a predefined range. With ImPlot3DSurfaceFlags_RowOffset, the grid is treated as a circular buffer of #y_count rows and ImPlot3DSpec::Offset
+// is the index of the first (oldest) row, so scrolling data only needs the newest row to be overwritten
 IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min = 0.0,
                               double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
 
-// Plots a 3D mesh given vertex positions and indices. Triangles are defined by the index buffer (every 3 indices form a triangle)
+// Same as above, but the fill is colormapped by #values (one per vertex) instead of the height of the vertices
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count, int y_count,
+                              double scale_min = 0.0, double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots a waterfall (e.g. a spectrogram history) as a surface. Rows are stored by ImPlot3D in a ring buffer of #max_rows rows, so each call only
+// needs the newest row of #count #values (pass nullptr to draw without appending a row). Values are placed evenly from #x_min to #x_max along X,
+// the newest row is at Y = 0 and older rows are placed every #row_step along Y. Projections of stored rows are cached and reused while the view
+// does not change. Changing #count or #max_rows clears the history. #scale_min and #scale_max behave as in PlotSurface
+IMPLOT3D_TMP void PlotWaterfall(const char* label_id, const T* values, int count, int max_rows, double x_min = 0.0, double x_max = 1.0,
+                                double row_step = 1.0, double scale_min = 0.0, double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots a heatmap of #rows x #cols #values (row-major) on the rectangle defined by #center, #axis_u and #axis_v (see PlotImage). Columns run along
+// #axis_u and rows along #axis_v, with the first value at center - axis_u - axis_v. The values are colormapped into a texture that is only updated
+// when #data_version changes (pass -1 to update it every frame), so dense grids cost a single textured quad per frame. Leave #scale_min and
+// #scale_max both at 0 for automatic color scaling. Without IMGUI_HAS_TEXTURES (Dear ImGui < 1.92), one flat quad per cell is rendered instead
+IMPLOT3D_TMP void PlotHeatmap3D(const char* label_id, const T* values, int rows, int cols, const ImPlot3DPoint& center, const ImPlot3DPoint& axis_u,
+                                const ImPlot3DPoint& axis_v, double scale_min = 0.0, double scale_max = 0.0, int data_version = -1,
+                                const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots a 3D mesh given vertex positions and indices. Triangles are defined by the index buffer (every 3 indices form a triangle). With
+// spec.ModelTransform, the vertices are in model coordinates and the transform is fused with the plot projection, so animating a rigid mesh only
+// needs a new transform each frame. The data version is then ignored, as the transformed vertices change with the transform
 IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
                            const ImPlot3DSpec& spec = ImPlot3DSpec());
 
+// Same as above, but each vertex is filled with its color in #vtx_colors, or each triangle (every 3 indices) with its color in #face_colors when
+// #vtx_colors is nullptr. The colors are used as is, so segmented models (e.g. one color per part) can be rendered as a single item
+IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                           const ImU32* vtx_colors, const ImU32* face_colors = nullptr, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Same as above, but the fill is colormapped by #values (one per vertex). #scale_min and #scale_max behave as in PlotSurface
+IMPLOT3D_TMP void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, const T* values, int vtx_count, int idx_count,
+                           double scale_min = 0.0, double scale_max = 0.0, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
+// Plots #instance_count copies of the mesh #vtx / #idx as a single item. Instance i is scaled by #scales[i], rotated by #rotations[i] and moved
+// to #positions[i] (#scales and #rotations may be nullptr for unit scale and no rotation). Each instance is filled with #colors[i] if #colors
+// isn't nullptr, or with the fill color otherwise. Instances are culled as a whole by their bounding sphere. Only the fill is rendered
+IMPLOT3D_API void PlotMeshInstanced(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                                    const ImPlot3DPoint* positions, const double* scales, const ImPlot3DQuat* rotations, int instance_count,
+                                    const ImU32* colors = nullptr, const ImPlot3DSpec& spec = ImPlot3DSpec());
+
 // Plots a rectangular image in 3D defined by its center and two direction vectors (axes).
 // #center is the center of the rectangle in plot coordinates.
 // #axis_u and #axis_v define the local axes and half-extents of the rectangle in 3D space.
@@ -644,6 +808,11 @@ IMPLOT3D_API void PlotImage(const char* label_id, ImTextureRef tex_ref, const Im
 // Plots a centered text label at point x,y,z with optional rotation angle (in radians) and pixel offset
 IMPLOT3D_API void PlotText(const char* text, double x, double y, double z, double angle = 0.0, const ImVec2& pix_offset = ImVec2(0, 0));
 
+// Plots #count centered text labels, #labels[i] at point xs[i],ys[i],zs[i] with an optional pixel offset. Labels overlapping a label that comes
+// before them in the arrays are skipped (unless ImPlot3DTextFlags_NoCollision is set), so sort the labels by decreasing priority
+IMPLOT3D_TMP void PlotTexts(const char* const* labels, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTextFlags flags = 0,
+                            const ImVec2& pix_offset = ImVec2(0, 0));
+
 // Plots a dummy item (can be used to modify legend entry appearance when called after plotting an item, or add a dummy legend entry)
 IMPLOT3D_API void PlotDummy(const char* label_id, const ImPlot3DSpec& spec = ImPlot3DSpec());
 
@@ -677,6 +846,19 @@ IMPLOT3D_API ImVec2 GetPlotRectSize();
 // Returns the ImDrawList used for rendering plot items. Use this to add custom rendering inside plots
 IMPLOT3D_API ImDrawList* GetPlotDrawList();
 
+// Returns the 3D draw list of the current plot, whose primitives are depth sorted with the plot items when the plot ends. Its low level API
+// (SetPrimFan, SetVtxStyle, PrimReserve...) is declared in implot3d_internal.h, prefer AddTriangles3D and AddLines3D for most uses. Calling it
+// disables the progressive refinement of the plot for the frame (see ImPlot3DFlags_Progressive), as the geometry written is rebuilt every frame
+IMPLOT3D_API ImDrawList3D* GetPlotDrawList3D();
+
+// Adds triangles to the current plot, depth sorted with the plot items. Every 3 consecutive points of #vtx (in plot coordinates) form a
+// triangle, triangles outside the plot box are culled (unless ImPlot3DFlags_NoClip is set)
+IMPLOT3D_API void AddTriangles3D(const ImPlot3DPoint* vtx, int count, ImU32 col);
+
+// Adds line segments of #thickness pixels to the current plot, depth sorted with the plot items. Every 2 consecutive points of #vtx (in plot
+// coordinates) form a segment, segments are clipped to the plot box (unless ImPlot3DFlags_NoClip is set)
+IMPLOT3D_API void AddLines3D(const ImPlot3DPoint* vtx, int count, ImU32 col, float thickness = 1.0f);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Styles API (legacy)
 //-----------------------------------------------------------------------------
@@ -806,40 +988,70 @@ struct ImPlot3DPoint {
         return ((const double*)(const void*)(const char*)this)[idx];
     }
 
-    // Binary operators
-    IMPLOT3D_API ImPlot3DPoint operator*(double rhs) const;
-    IMPLOT3D_API ImPlot3DPoint operator/(double rhs) const;
-    IMPLOT3D_API ImPlot3DPoint operator+(const ImPlot3DPoint& rhs) const;
-    IMPLOT3D_API ImPlot3DPoint operator-(const ImPlot3DPoint& rhs) const;
-    IMPLOT3D_API ImPlot3DPoint operator*(const ImPlot3DPoint& rhs) const;
-    IMPLOT3D_API ImPlot3DPoint operator/(const ImPlot3DPoint& rhs) const;
+    // Binary operators (defined inline, they are used in the hot loops of the renderers)
+    ImPlot3DPoint operator*(double rhs) const { return ImPlot3DPoint(x * rhs, y * rhs, z * rhs); }
+    ImPlot3DPoint operator/(double rhs) const { return ImPlot3DPoint(x / rhs, y / rhs, z / rhs); }
+    ImPlot3DPoint operator+(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x + rhs.x, y + rhs.y, z + rhs.z); }
+    ImPlot3DPoint operator-(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x - rhs.x, y - rhs.y, z - rhs.z); }
+    ImPlot3DPoint operator*(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x * rhs.x, y * rhs.y, z * rhs.z); }
+    ImPlot3DPoint operator/(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(x / rhs.x, y / rhs.y, z / rhs.z); }
 
     // Unary operator
-    IMPLOT3D_API ImPlot3DPoint operator-() const;
+    ImPlot3DPoint operator-() const { return ImPlot3DPoint(-x, -y, -z); }
 
     // Compound assignment operators
-    IMPLOT3D_API ImPlot3DPoint& operator*=(double rhs);
-    IMPLOT3D_API ImPlot3DPoint& operator/=(double rhs);
-    IMPLOT3D_API ImPlot3DPoint& operator+=(const ImPlot3DPoint& rhs);
-    IMPLOT3D_API ImPlot3DPoint& operator-=(const ImPlot3DPoint& rhs);
-    IMPLOT3D_API ImPlot3DPoint& operator*=(const ImPlot3DPoint& rhs);
-    IMPLOT3D_API ImPlot3DPoint& operator/=(const ImPlot3DPoint& rhs);
+    ImPlot3DPoint& operator*=(double rhs) {
+        x *= rhs;
+        y *= rhs;
+        z *= rhs;
+        return *this;
+    }
+    ImPlot3DPoint& operator/=(double rhs) {
+        x /= rhs;
+        y /= rhs;
+        z /= rhs;
+        return *this;
+    }
+    ImPlot3DPoint& operator+=(const ImPlot3DPoint& rhs) {
+        x += rhs.x;
+        y += rhs.y;
+        z += rhs.z;
+        return *this;
+    }
+    ImPlot3DPoint& operator-=(const ImPlot3DPoint& rhs) {
+        x -= rhs.x;
+        y -= rhs.y;
+        z -= rhs.z;
+        return *this;
+    }
+    ImPlot3DPoint& operator*=(const ImPlot3DPoint& rhs) {
+        x *= rhs.x;
+        y *= rhs.y;
+        z *= rhs.z;
+        return *this;
+    }
+    ImPlot3DPoint& operator/=(const ImPlot3DPoint& rhs) {
+        x /= rhs.x;
+        y /= rhs.y;
+        z /= rhs.z;
+        return *this;
+    }
 
     // Comparison operators
-    IMPLOT3D_API bool operator==(const ImPlot3DPoint& rhs) const;
-    IMPLOT3D_API bool operator!=(const ImPlot3DPoint& rhs) const;
+    bool operator==(const ImPlot3DPoint& rhs) const { return x == rhs.x && y == rhs.y && z == rhs.z; }
+    bool operator!=(const ImPlot3DPoint& rhs) const { return !(*this == rhs); }
 
     // Dot product
-    IMPLOT3D_API double Dot(const ImPlot3DPoint& rhs) const;
+    double Dot(const ImPlot3DPoint& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z; }
 
     // Cross product
-    IMPLOT3D_API ImPlot3DPoint Cross(const ImPlot3DPoint& rhs) const;
+    ImPlot3DPoint Cross(const ImPlot3DPoint& rhs) const { return ImPlot3DPoint(y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x); }
 
     // Get vector length
     IMPLOT3D_API double Length() const;
 
     // Get vector squared length
-    IMPLOT3D_API double LengthSquared() const;
+    double LengthSquared() const { return x * x + y * y + z * z; }
 
     // Normalize to unit length
     IMPLOT3D_API void Normalize();
@@ -848,11 +1060,14 @@ struct ImPlot3DPoint {
     IMPLOT3D_API ImPlot3DPoint Normalized() const;
 
     // Friend binary operators to allow commutative behavior
-    IMPLOT3D_API friend ImPlot3DPoint operator*(double lhs, const ImPlot3DPoint& rhs);
+    friend ImPlot3DPoint operator*(double lhs, const ImPlot3DPoint& rhs) { return ImPlot3DPoint(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z); }
 
     // Check if the point is NaN
     IMPLOT3D_API bool IsNaN() const;
 
+    // Write the centroid of each group of #group_size consecutive points of #in to #out (e.g. 3 for triangles), for #count groups
+    IMPLOT3D_API static void Centroids(const ImPlot3DPoint* in, int group_size, ImPlot3DPoint* out, int count);
+
 #ifdef IMPLOT3D_POINT_CLASS_EXTRA
     IMPLOT3D_POINT_CLASS_EXTRA // Define additional constructors and implicit cast operators in imconfig.h to convert back and forth between your math
                                // types and ImPlot3DPoint
@@ -949,29 +1164,46 @@ struct ImPlot3DQuat {
     IMPLOT3D_API ImPlot3DQuat Normalized() const;
 
     // Conjugate of the quaternion
-    IMPLOT3D_API ImPlot3DQuat Conjugate() const;
+    ImPlot3DQuat Conjugate() const { return ImPlot3DQuat(-x, -y, -z, w); }
 
     // Inverse of the quaternion
     IMPLOT3D_API ImPlot3DQuat Inverse() const;
 
     // Binary operators
-    IMPLOT3D_API ImPlot3DQuat operator*(const ImPlot3DQuat& rhs) const; // Quaternion multiplication
+    ImPlot3DQuat operator*(const ImPlot3DQuat& rhs) const { // Quaternion multiplication
+        return ImPlot3DQuat(w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y, w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
+                            w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w, w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z);
+    }
 
     // Normalize the quaternion in place
     IMPLOT3D_API ImPlot3DQuat& Normalize();
 
     // Rotate a 3D point using the quaternion
-    IMPLOT3D_API ImPlot3DPoint operator*(const ImPlot3DPoint& point) const;
+    ImPlot3DPoint operator*(const ImPlot3DPoint& point) const {
+        // Extract vector part of the quaternion
+        ImPlot3DPoint qv(x, y, z);
+
+        // Compute the cross products needed for rotation
+        ImPlot3DPoint uv = qv.Cross(point); // uv = qv x point
+        ImPlot3DPoint uuv = qv.Cross(uv);   // uuv = qv x uv
+
+        // Compute the rotated vector
+        return point + (uv * w * 2.0) + (uuv * 2.0);
+    }
+
+    // Rotate #count points of #in, writing them to #out (which may be #in). Faster than rotating the points one by one, the quaternion is
+    // converted to a rotation matrix once and the loop has no dependency between points, so compilers vectorize it
+    IMPLOT3D_API void Rotate(const ImPlot3DPoint* in, ImPlot3DPoint* out, int count) const;
 
     // Comparison operators
-    IMPLOT3D_API bool operator==(const ImPlot3DQuat& rhs) const;
-    IMPLOT3D_API bool operator!=(const ImPlot3DQuat& rhs) const;
+    bool operator==(const ImPlot3DQuat& rhs) const { return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w; }
+    bool operator!=(const ImPlot3DQuat& rhs) const { return !(*this == rhs); }
 
     // Spherical linear interpolation between two quaternions (t in [0,1])
     IMPLOT3D_API static ImPlot3DQuat Slerp(const ImPlot3DQuat& q1, const ImPlot3DQuat& q2, double t);
 
     // Get quaternion dot product
-    IMPLOT3D_API double Dot(const ImPlot3DQuat& rhs) const;
+    double Dot(const ImPlot3DQuat& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
 
 #ifdef IMPLOT3D_QUAT_CLASS_EXTRA
     IMPLOT3D_QUAT_CLASS_EXTRA // Define additional constructors and implicit cast operators in imconfig.h to convert back and forth between your math
@@ -979,6 +1211,25 @@ struct ImPlot3DQuat {
 #endif
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImPlot3DModelTransform
+//-----------------------------------------------------------------------------
+
+// Transform from model coordinates to plot coordinates: the model is scaled by Scale, rotated by Rotation and moved by Translation
+struct ImPlot3DModelTransform {
+    ImPlot3DPoint Translation; // Position of the model origin in plot coordinates
+    ImPlot3DQuat Rotation;     // Rotation of the model around its origin
+    double Scale;              // Uniform scale of the model
+
+    // Constructors
+    constexpr ImPlot3DModelTransform() : Translation(), Rotation(), Scale(1.0) {}
+    constexpr ImPlot3DModelTransform(const ImPlot3DPoint& translation, const ImPlot3DQuat& rotation = ImPlot3DQuat(), double scale = 1.0)
+        : Translation(translation), Rotation(rotation), Scale(scale) {}
+
+    // Transform a point from model to plot coordinates
+    ImPlot3DPoint Apply(const ImPlot3DPoint& point) const { return Translation + Rotation * (point * Scale); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImPlot3DStyle
 //-----------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 // [SECTION] Axes
 // [SECTION] Tools
 // [SECTION] Custom
+// [SECTION] Performance
 // [SECTION] Config
 // [SECTION] Demo Window
 // [SECTION] Style Editor
@@ -135,6 +136,94 @@ void DemoLinePlots() {
     }
 }
 
+void DemoColoredLines() {
+    IMGUI_DEMO_MARKER("Plots/Colored Lines");
+    static int color_mode = 0;
+    ImGui::Combo("Color Mode##ColoredLines", &color_mode, "Colormap Speed\0Per-Point Colors\0\0");
+    ImGui::SameLine();
+    HelpMarker("Colormap Speed: colormap the line by a scalar value per point, here the speed along a Lorenz attractor trajectory.\n"
+               "Per-Point Colors: one color per point, here fading from the start to the end of the trajectory.\n"
+               "Either way the colors are interpolated along each segment and the whole trajectory is a single item.");
+
+    // Lorenz attractor trajectory
+    const int count = 20000;
+    static ImVector<double> xs, ys, zs, speeds;
+    static ImVector<ImU32> colors;
+    if (xs.empty()) {
+        xs.resize(count);
+        ys.resize(count);
+        zs.resize(count);
+        speeds.resize(count);
+        colors.resize(count);
+        double x = 0.1, y = 0.0, z = 0.0;
+        const double dt = 0.005;
+        for (int i = 0; i < count; i++) {
+            const double dx = 10.0 * (y - x), dy = x * (28.0 - z) - y, dz = x * y - 8.0 / 3.0 * z;
+            x += dx * dt;
+            y += dy * dt;
+            z += dz * dt;
+            xs[i] = x;
+            ys[i] = y;
+            zs[i] = z;
+            speeds[i] = ImSqrt(dx * dx + dy * dy + dz * dz);
+            const float t = (float)i / (count - 1);
+            colors[i] = ImGui::ColorConvertFloat4ToU32(ImVec4(1.0f - t, 0.4f, t, 1.0f));
+        }
+    }
+
+    if (ImPlot3D::BeginPlot("Colored Lines")) {
+        ImPlot3D::SetupAxes("x", "y", "z");
+        if (color_mode == 0)
+            ImPlot3D::PlotLine("Lorenz", xs.Data, ys.Data, zs.Data, speeds.Data, count);
+        else
+            ImPlot3D::PlotLine("Lorenz", xs.Data, ys.Data, zs.Data, count, colors.Data);
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoTubes() {
+    IMGUI_DEMO_MARKER("Plots/Tubes");
+    static float radius = 0.25f;
+    static bool ribbon = true;
+    static bool shading = true;
+    ImGui::SliderFloat("Radius##Tubes", &radius, 0.05f, 0.6f);
+    ImGui::SameLine();
+    ImGui::Checkbox("Ribbon##Tubes", &ribbon);
+    ImGui::SameLine();
+    ImGui::Checkbox("Shading##Tubes", &shading);
+    ImGui::SameLine();
+    HelpMarker("A trefoil knot swept as a tube, and a helix swept as a tube or as a ribbon (ImPlot3DTubeFlags_Ribbon).\n"
+               "The sweep is cached with the data version, so rotating the plot only projects the cached geometry. The number of sides "
+               "follows the projected radius: zoom in and out to see it change.");
+
+    // Trefoil knot and helix
+    const int count = 400;
+    static double knot_xs[count], knot_ys[count], knot_zs[count];
+    static double helix_xs[count], helix_ys[count], helix_zs[count];
+    static bool init = true;
+    for (int i = 0; init && i < count; i++) {
+        const float t = 2 * IM_PI * i / (count - 1);
+        knot_xs[i] = ImSin(t) + 2 * ImSin(2 * t);
+        knot_ys[i] = ImCos(t) - 2 * ImCos(2 * t);
+        knot_zs[i] = -ImSin(3 * t);
+        helix_xs[i] = 4.0 + 0.8 * ImCos(3 * t);
+        helix_ys[i] = 0.8 * ImSin(3 * t);
+        helix_zs[i] = -1.5 + 3.0 * i / (count - 1);
+    }
+    init = false;
+
+    if (ImPlot3D::BeginPlot("Tubes", ImVec2(-1, 0), ImPlot3DFlags_Equal)) {
+        ImPlot3D::SetupAxes("x", "y", "z");
+        ImPlot3DSpec spec(ImPlot3DProp_DataVersion, 0);
+        spec.Flags = shading ? ImPlot3DTubeFlags_None : ImPlot3DTubeFlags_NoShading;
+        ImPlot3D::PlotTube("Knot", knot_xs, knot_ys, knot_zs, count, radius, spec);
+        if (ribbon)
+            spec.Flags |= ImPlot3DTubeFlags_Ribbon;
+        ImPlot3D::PlotTube("Helix", helix_xs, helix_ys, helix_zs, count, radius, spec);
+        ImPlot3D::EndPlot();
+    }
+}
+
 void DemoScatterPlots() {
     IMGUI_DEMO_MARKER("Plots/Scatter Plots");
     srand(0);
@@ -151,9 +240,15 @@ void DemoScatterPlots() {
         zs2[i] = 0.75f + 0.2f * ((float)rand() / (float)RAND_MAX);
     }
 
+    // Sprite markers render each marker as a single textured quad from the font atlas
+    static bool sprite_markers = false;
+    ImGui::Checkbox("Sprite Markers", &sprite_markers);
+    ImPlot3DItemFlags item_flags = sprite_markers ? ImPlot3DItemFlags_SpriteMarkers : ImPlot3DItemFlags_None;
+
     if (ImPlot3D::BeginPlot("Scatter Plots")) {
-        ImPlot3D::PlotScatter("Data 1", xs1, ys1, zs1, 100);
+        ImPlot3D::PlotScatter("Data 1", xs1, ys1, zs1, 100, {ImPlot3DProp_Flags, item_flags});
         ImPlot3DSpec spec;
+        spec.Flags = item_flags;
         spec.Marker = ImPlot3DMarker_Square;
         spec.MarkerSize = 6;
         spec.MarkerLineColor = ImPlot3D::GetColormapColor(1);
@@ -334,7 +429,7 @@ void DemoQuadPlots() {
 void DemoSurfacePlots() {
     IMGUI_DEMO_MARKER("Plots/Surface Plots");
     constexpr int N = 20;
-    static float xs[N * N], ys[N * N], zs[N * N];
+    static float xs[N * N], ys[N * N], zs[N * N], slopes[N * N];
     static float t = 0.0f;
     t += ImGui::GetIO().DeltaTime;
 
@@ -347,9 +442,10 @@ void DemoSurfacePlots() {
     for (int i = 0; i < N; i++) {
         for (int j = 0; j < N; j++) {
             int idx = i * N + j;
-            xs[idx] = min_val + j * step;                                             // X values are constant along rows
-            ys[idx] = min_val + i * step;                                             // Y values are constant along columns
-            zs[idx] = ImSin(2 * t + ImSqrt((xs[idx] * xs[idx] + ys[idx] * ys[idx]))); // z = sin(2t + sqrt(x^2 + y^2))
+            xs[idx] = min_val + j * step;                                                 // X values are constant along rows
+            ys[idx] = min_val + i * step;                                                 // Y values are constant along columns
+            zs[idx] = ImSin(2 * t + ImSqrt((xs[idx] * xs[idx] + ys[idx] * ys[idx])));     // z = sin(2t + sqrt(x^2 + y^2))
+            slopes[idx] = ImCos(2 * t + ImSqrt((xs[idx] * xs[idx] + ys[idx] * ys[idx]))); // dz/dr = cos(2t + sqrt(x^2 + y^2))
         }
     }
 
@@ -375,6 +471,15 @@ void DemoSurfacePlots() {
             ImGui::SameLine();
             ImGui::Combo("##SurfaceColormap", &sel_colormap, colormaps, IM_ARRAYSIZE(colormaps));
         }
+
+        // Colormap by another scalar field than the height
+        ImGui::RadioButton("Colormap by slope", &selected_fill, 2);
+        ImGui::SameLine();
+        HelpMarker("The fill is colormapped by an array of per-vertex values (here the radial slope of the surface) instead of z.");
+        if (selected_fill == 2) {
+            ImGui::SameLine();
+            ImGui::Combo("##SurfaceSlopeColormap", &sel_colormap, colormaps, IM_ARRAYSIZE(colormaps));
+        }
         ImGui::Unindent();
     }
 
@@ -403,7 +508,7 @@ void DemoSurfacePlots() {
     CHECKBOX_FLAG(flags, ImPlot3DSurfaceFlags_NoMarkers);
 
     // Begin the plot
-    if (selected_fill == 1)
+    if (selected_fill != 0)
         ImPlot3D::PushColormap(colormaps[sel_colormap]);
     if (ImPlot3D::BeginPlot("Surface Plots", ImVec2(-1, 0), ImPlot3DFlags_NoClip)) {
         ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1.5, 1.5);
@@ -417,18 +522,109 @@ void DemoSurfacePlots() {
             spec.FillColor = solid_color;
 
         // Plot the surface
-        if (custom_range)
-            ImPlot3D::PlotSurface("Wave Surface", xs, ys, zs, N, N, (double)range_min, (double)range_max, spec);
+        const double scale_min = custom_range ? (double)range_min : 0.0;
+        const double scale_max = custom_range ? (double)range_max : 0.0;
+        if (selected_fill == 2)
+            ImPlot3D::PlotSurface("Wave Surface", xs, ys, zs, slopes, N, N, scale_min, scale_max, spec);
         else
-            ImPlot3D::PlotSurface("Wave Surface", xs, ys, zs, N, N, 0.0, 0.0, spec);
+            ImPlot3D::PlotSurface("Wave Surface", xs, ys, zs, N, N, scale_min, scale_max, spec);
 
         // End the plot
         ImPlot3D::EndPlot();
     }
-    if (selected_fill == 1)
+    if (selected_fill != 0)
         ImPlot3D::PopColormap();
 }
 
+void DemoWaterfallPlots() {
+    IMGUI_DEMO_MARKER("Plots/Waterfall Plots");
+    constexpr int N = 64;     // Bins per row
+    constexpr int ROWS = 120; // Rows kept by ImPlot3D
+    static float row[N];
+    static float t = 0.0f;
+    static float last_t = -1.0f;
+    static bool paused = false;
+    if (!paused)
+        t += ImGui::GetIO().DeltaTime;
+
+    // Generate a new spectrum row every 20 ms with two drifting peaks and some noise
+    bool new_row = t - last_t > 0.02f;
+    if (new_row) {
+        last_t = t;
+        float peak1 = 0.5f + 0.3f * ImSin(0.7f * t);
+        float peak2 = 0.3f + 0.15f * ImCos(1.9f * t);
+        for (int i = 0; i < N; i++) {
+            float f = (float)i / (N - 1);
+            float d1 = (f - peak1) / 0.04f;
+            float d2 = (f - peak2) / 0.02f;
+            row[i] = expf(-d1 * d1) + 0.6f * expf(-d2 * d2) + 0.08f * ((float)rand() / (float)RAND_MAX);
+        }
+    }
+
+    ImGui::BulletText("Only the newest row is passed each frame; ImPlot3D keeps the last %d rows.", ROWS);
+    ImGui::BulletText("Rows are projected once and reused while the view does not change.");
+    ImGui::Checkbox("Pause", &paused);
+
+    // Select flags
+    static ImPlot3DWaterfallFlags flags = ImPlot3DWaterfallFlags_NoLines;
+    CHECKBOX_FLAG(flags, ImPlot3DWaterfallFlags_NoLines);
+    CHECKBOX_FLAG(flags, ImPlot3DWaterfallFlags_NoFill);
+
+    ImPlot3D::PushColormap(ImPlot3DColormap_Viridis);
+    if (ImPlot3D::BeginPlot("Waterfall Plots", ImVec2(-1, 0))) {
+        ImPlot3D::SetupAxes("Frequency", "Age", "Power");
+        ImPlot3D::SetupAxesLimits(0, 1, 0, ROWS - 1, 0, 1.5);
+
+        ImPlot3DSpec spec;
+        spec.Flags = flags;
+        spec.LineColor = ImVec4(0, 0, 0, 0.3f);
+        ImPlot3D::PlotWaterfall("Spectrum", new_row ? row : nullptr, N, ROWS, 0.0, 1.0, 1.0, 0.0, 1.2, spec);
+
+        ImPlot3D::EndPlot();
+    }
+    ImPlot3D::PopColormap();
+}
+
+void DemoHeatmap3D() {
+    IMGUI_DEMO_MARKER("Plots/Heatmap Plots");
+    constexpr int ROWS = 256;
+    constexpr int COLS = 256;
+    static float values[ROWS * COLS];
+    static int version = -1;
+    static float t = 0.0f;
+    static bool animate = true;
+
+    // Regenerate the values only while animating, bumping the version so ImPlot3D uploads them again
+    if (animate || version < 0) {
+        t += ImGui::GetIO().DeltaTime;
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) {
+                float x = 8.0f * c / (COLS - 1) - 4.0f;
+                float y = 8.0f * r / (ROWS - 1) - 4.0f;
+                values[r * COLS + c] = ImSin(x + t) * ImCos(y - 0.5f * t) + 0.5f * ImSin(ImSqrt(x * x + y * y) * 2.0f - 2.0f * t);
+            }
+        }
+        version++;
+    }
+
+    ImGui::BulletText("A %dx%d grid drawn as a single textured quad on an arbitrary plane.", COLS, ROWS);
+    ImGui::BulletText("The texture is only updated when the data version changes.");
+    ImGui::Checkbox("Animate", &animate);
+    ImGui::SameLine();
+    ImGui::Text("Version: %d", version);
+    static float tilt = 0.5f;
+    ImGui::SliderFloat("Tilt", &tilt, -1.0f, 1.0f);
+
+    ImPlot3D::PushColormap(ImPlot3DColormap_Plasma);
+    if (ImPlot3D::BeginPlot("Heatmap Plots", ImVec2(-1, 0))) {
+        ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
+        ImPlot3D::PlotHeatmap3D("Heatmap", values, ROWS, COLS, ImPlot3DPoint(0, 0, 0), ImPlot3DPoint(0.8, 0, 0), ImPlot3DPoint(0, 0.8, 0.8 * tilt),
+                                -1.5, 1.5, version);
+        ImPlot3D::EndPlot();
+    }
+    ImPlot3D::PopColormap();
+}
+
 void DemoMeshPlots() {
     IMGUI_DEMO_MARKER("Plots/Mesh Plots");
     static int mesh_id = 0;
@@ -441,6 +637,12 @@ void DemoMeshPlots() {
     // Choose fill color
     static ImVec4 fill_color = ImVec4(0.8f, 0.8f, 0.2f, 0.6f);
     ImGui::ColorEdit4("Fill Color##Mesh", (float*)&fill_color);
+    static int fill_mode = 0;
+    ImGui::Combo("Fill Mode##Mesh", &fill_mode, "Solid\0Colormap Values\0Vertex Colors\0Face Colors\0\0");
+    ImGui::SameLine();
+    HelpMarker("Colormap Values: colormap the fill by a scalar value per vertex, here the distance to a hot spot at (1, 1, 1).\n"
+               "Vertex Colors: one color per vertex, here from its position.\n"
+               "Face Colors: one color per triangle, here one colormap color per pair of triangles.");
 
     // Choose marker color
     static ImVec4 marker_color = ImVec4(0.5f, 0.5f, 0.2f, 0.6f);
@@ -451,6 +653,10 @@ void DemoMeshPlots() {
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoLines);
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoFill);
     CHECKBOX_FLAG(flags, ImPlot3DMeshFlags_NoMarkers);
+    static bool model_transform = false;
+    ImGui::Checkbox("Model Transform", &model_transform);
+    ImGui::SameLine();
+    HelpMarker("Spins the mesh with a model transform passed in the spec, instead of rewriting its vertices every frame.");
 
     if (ImPlot3D::BeginPlot("Mesh Plots")) {
         ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
@@ -466,15 +672,99 @@ void DemoMeshPlots() {
         spec.MarkerSize = 3.0f;
         spec.MarkerLineColor = marker_color;
         spec.MarkerFillColor = marker_color;
+        // Set model transform
+        ImPlot3DModelTransform model(ImPlot3DPoint(0.0, 0.0, 0.0), ImPlot3DQuat(ImGui::GetTime(), ImPlot3DPoint(0.0, 0.0, 1.0)), 0.8);
+        if (model_transform)
+            spec.ModelTransform = &model;
+
+        // Select mesh
+        const char* label = mesh_id == 0 ? "Duck" : mesh_id == 1 ? "Sphere" : "Cube";
+        const ImPlot3DPoint* vtx = mesh_id == 0 ? duck_vtx : mesh_id == 1 ? sphere_vtx : cube_vtx;
+        const unsigned int* idx = mesh_id == 0 ? duck_idx : mesh_id == 1 ? sphere_idx : cube_idx;
+        const int vtx_count = mesh_id == 0 ? DUCK_VTX_COUNT : mesh_id == 1 ? SPHERE_VTX_COUNT : CUBE_VTX_COUNT;
+        const int idx_count = mesh_id == 0 ? DUCK_IDX_COUNT : mesh_id == 1 ? SPHERE_IDX_COUNT : CUBE_IDX_COUNT;
 
         // Plot mesh
-        if (mesh_id == 0)
-            ImPlot3D::PlotMesh("Duck", duck_vtx, duck_idx, DUCK_VTX_COUNT, DUCK_IDX_COUNT, spec);
-        else if (mesh_id == 1)
-            ImPlot3D::PlotMesh("Sphere", sphere_vtx, sphere_idx, SPHERE_VTX_COUNT, SPHERE_IDX_COUNT, spec);
-        else if (mesh_id == 2)
-            ImPlot3D::PlotMesh("Cube", cube_vtx, cube_idx, CUBE_VTX_COUNT, CUBE_IDX_COUNT, spec);
+        if (fill_mode == 1) {
+            static ImVector<double> values;
+            values.resize(vtx_count);
+            for (int i = 0; i < vtx_count; i++)
+                values[i] = ImSqrt((vtx[i].x - 1) * (vtx[i].x - 1) + (vtx[i].y - 1) * (vtx[i].y - 1) + (vtx[i].z - 1) * (vtx[i].z - 1));
+            ImPlot3D::PlotMesh(label, vtx, idx, values.Data, vtx_count, idx_count, 0.0, 0.0, spec);
+        } else if (fill_mode == 2) {
+            static ImVector<ImU32> vtx_colors;
+            vtx_colors.resize(vtx_count);
+            for (int i = 0; i < vtx_count; i++) {
+                ImVec4 col((float)(vtx[i].x * 0.5 + 0.5), (float)(vtx[i].y * 0.5 + 0.5), (float)(vtx[i].z * 0.5 + 0.5), fill_color.w);
+                vtx_colors[i] = ImGui::ColorConvertFloat4ToU32(col);
+            }
+            ImPlot3D::PlotMesh(label, vtx, idx, vtx_count, idx_count, vtx_colors.Data, nullptr, spec);
+        } else if (fill_mode == 3) {
+            static ImVector<ImU32> face_colors;
+            face_colors.resize(idx_count / 3);
+            for (int i = 0; i < face_colors.Size; i++) {
+                ImVec4 col = ImPlot3D::GetColormapColor(i / 2);
+                col.w = fill_color.w;
+                face_colors[i] = ImGui::ColorConvertFloat4ToU32(col);
+            }
+            ImPlot3D::PlotMesh(label, vtx, idx, vtx_count, idx_count, nullptr, face_colors.Data, spec);
+        } else {
+            ImPlot3D::PlotMesh(label, vtx, idx, vtx_count, idx_count, spec);
+        }
+
+        ImPlot3D::EndPlot();
+    }
+}
+
+void DemoInstancedMeshes() {
+    IMGUI_DEMO_MARKER("Plots/Instanced Meshes");
+    static int mesh_id = 0;
+    ImGui::Combo("Mesh##Instanced", &mesh_id, "Sphere\0Cube\0Duck\0\0");
+    static int grid_size = 10;
+    ImGui::SliderInt("Grid Size", &grid_size, 2, 40);
+    ImGui::SameLine();
+    HelpMarker("One instance per grid node, all rendered as a single item.");
+    static bool instance_colors = true;
+    ImGui::Checkbox("Per-Instance Colors", &instance_colors);
+    ImGui::SameLine();
+    static bool animate = true;
+    ImGui::Checkbox("Animate##Instanced", &animate);
+
+    // Instances on a grid, scaled by a wave running through it and spinning around their own z axis
+    static float t = 0.0f;
+    if (animate)
+        t += ImGui::GetIO().DeltaTime;
+    const int count = grid_size * grid_size * grid_size;
+    static ImVector<ImPlot3DPoint> positions;
+    static ImVector<double> scales;
+    static ImVector<ImPlot3DQuat> rotations;
+    static ImVector<ImU32> colors;
+    positions.resize(count);
+    scales.resize(count);
+    rotations.resize(count);
+    colors.resize(count);
+    const double spacing = 2.0 / (grid_size - 1);
+    int i = 0;
+    for (int ix = 0; ix < grid_size; ix++) {
+        for (int iy = 0; iy < grid_size; iy++) {
+            for (int iz = 0; iz < grid_size; iz++, i++) {
+                positions[i] = ImPlot3DPoint(-1.0 + ix * spacing, -1.0 + iy * spacing, -1.0 + iz * spacing);
+                const double wave = 0.5 + 0.5 * ImSin(2.0 * t + 3.0 * positions[i].x + 2.0 * positions[i].y);
+                scales[i] = spacing * (0.15 + 0.25 * wave);
+                rotations[i] = ImPlot3DQuat(t + i * 0.1, ImPlot3DPoint(0.0, 0.0, 1.0));
+                colors[i] = ImGui::ColorConvertFloat4ToU32(ImPlot3D::SampleColormap((float)wave));
+            }
+        }
+    }
 
+    if (ImPlot3D::BeginPlot("Instanced Meshes")) {
+        ImPlot3D::SetupAxesLimits(-1.2, 1.2, -1.2, 1.2, -1.2, 1.2);
+        const ImPlot3DPoint* vtx = mesh_id == 0 ? sphere_vtx : mesh_id == 1 ? cube_vtx : duck_vtx;
+        const unsigned int* idx = mesh_id == 0 ? sphere_idx : mesh_id == 1 ? cube_idx : duck_idx;
+        const int vtx_count = mesh_id == 0 ? SPHERE_VTX_COUNT : mesh_id == 1 ? CUBE_VTX_COUNT : DUCK_VTX_COUNT;
+        const int idx_count = mesh_id == 0 ? SPHERE_IDX_COUNT : mesh_id == 1 ? CUBE_IDX_COUNT : DUCK_IDX_COUNT;
+        ImPlot3D::PlotMeshInstanced("Instances", vtx, idx, vtx_count, idx_count, positions.Data, scales.Data, rotations.Data, count,
+                                    instance_colors ? colors.Data : nullptr);
         ImPlot3D::EndPlot();
     }
 }
@@ -604,6 +894,48 @@ void DemoRealtimePlots() {
     }
 }
 
+void DemoScrollingSurface() {
+    IMGUI_DEMO_MARKER("Plots/Scrolling Surface");
+    ImGui::BulletText("The surface is stored as a ring of rows and only the newest row is written.");
+    ImGui::BulletText("ImPlot3DSurfaceFlags_RowOffset makes ImPlot3DSpec::Offset point to the oldest row.");
+    constexpr int NX = 40; // Values per row
+    constexpr int NY = 60; // Rows in the ring
+    static float xs[NX * NY], ys[NX * NY], zs[NX * NY];
+    static int head = 0;      // Ring slot of the oldest row (next row to overwrite)
+    static int rows_used = 0; // Number of rows written so far
+    static float t = 0.0f;
+    static float last_t = -1.0f;
+    t += ImGui::GetIO().DeltaTime;
+
+    // Write a new row every 50 ms, overwriting the oldest one
+    if (t - last_t > 0.05f) {
+        last_t = t;
+        for (int i = 0; i < NX; i++) {
+            float x = (float)i / (NX - 1);
+            xs[head * NX + i] = x;
+            ys[head * NX + i] = t;
+            zs[head * NX + i] = 0.5f * ImSin(6.0f * x + 2.0f * t) * ImCos(1.3f * t) + 0.2f * ImSin(15.0f * x - 3.0f * t);
+        }
+        head = (head + 1) % NY;
+        rows_used = ImMin(rows_used + 1, NY);
+    }
+
+    ImPlot3D::PushColormap(ImPlot3DColormap_Plasma);
+    if (ImPlot3D::BeginPlot("Scrolling Surface")) {
+        ImPlot3D::SetupAxes("X", "Time", "Z");
+        ImPlot3D::SetupAxisLimits(ImAxis3D_X, 0, 1, ImPlot3DCond_Once);
+        ImPlot3D::SetupAxisLimits(ImAxis3D_Y, t - NY * 0.05, t, ImPlot3DCond_Always);
+        ImPlot3D::SetupAxisLimits(ImAxis3D_Z, -1, 1, ImPlot3DCond_Once);
+        // Until the ring is full, the written rows are [0, rows_used) and the oldest one is row 0
+        ImPlot3DSpec spec;
+        spec.Flags = ImPlot3DSurfaceFlags_RowOffset | ImPlot3DSurfaceFlags_NoLines;
+        spec.Offset = rows_used == NY ? head : 0;
+        ImPlot3D::PlotSurface("Heightmap", xs, ys, zs, NX, rows_used, -0.7, 0.7, spec);
+        ImPlot3D::EndPlot();
+    }
+    ImPlot3D::PopColormap();
+}
+
 void DemoPlotFlags() {
     IMGUI_DEMO_MARKER("Plots/Plot Flags");
     static ImPlot3DFlags flags = ImPlot3DFlags_None;
@@ -824,7 +1156,8 @@ void DemoMarkersAndText() {
     IMGUI_DEMO_MARKER("Plots/Markers and Text");
     static float mk_size = ImPlot3D::GetStyle().MarkerSize;
     static float mk_weight = ImPlot3D::GetStyle().LineWeight;
-    ImGui::DragFloat("Marker Size", &mk_size, 0.1f, 2.0f, 10.0f, "%.2f px");
+    ImGui::BulletText("Markers of 4 px or less are drawn with simplified shapes (hexagons, then squares without outline).");
+    ImGui::DragFloat("Marker Size", &mk_size, 0.1f, 1.0f, 10.0f, "%.2f px");
     ImGui::DragFloat("Marker Weight", &mk_weight, 0.05f, 0.5f, 3.0f, "%.2f px");
 
     if (ImPlot3D::BeginPlot("##MarkerStyles", ImVec2(-1, 0), ImPlot3DFlags_CanvasOnly)) {
@@ -880,6 +1213,118 @@ void DemoMarkersAndText() {
     }
 }
 
+void DemoDepthSorting() {
+    IMGUI_DEMO_MARKER("Plots/Depth Sorting");
+    static bool floor_no_sort = true;
+    static bool column_pre_sorted = true;
+    ImGui::Checkbox("Floor: No Depth Sort", &floor_no_sort);
+    ImGui::SameLine();
+    HelpMarker("The floor is always behind the other items, so it can be drawn first without being sorted.");
+    ImGui::Checkbox("Column: Pre-Sorted", &column_pre_sorted);
+    ImGui::SameLine();
+    HelpMarker("The column points are ordered from bottom to top, which is back to front while looking from above. They are merged with the "
+               "sorted primitives instead of being sorted (or sorted anyway when the view makes the order wrong).");
+
+    // Surface data
+    const int N = 40;
+    static float xs[N * N], ys[N * N], zs[N * N];
+    // Column of points ordered from bottom to top
+    const int M = 200;
+    static float cxs[M], cys[M], czs[M];
+    static bool initialized = false;
+    if (!initialized) {
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                const int idx = i * N + j;
+                xs[idx] = -1.0f + 2.0f * j / (N - 1);
+                ys[idx] = -1.0f + 2.0f * i / (N - 1);
+                zs[idx] = 0.3f * ImSin(3.0f * xs[idx]) * ImCos(3.0f * ys[idx]);
+            }
+        }
+        for (int i = 0; i < M; i++) {
+            cxs[i] = 0.3f * ImCos(0.2f * i);
+            cys[i] = 0.3f * ImSin(0.2f * i);
+            czs[i] = -1.0f + 2.0f * i / (M - 1);
+        }
+        initialized = true;
+    }
+    static const float floor_xs[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+    static const float floor_ys[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+    static const float floor_zs[4] = {-1.0f, -1.0f, -1.0f, -1.0f};
+
+    static ImPlot3DPlotStats stats;
+    ImGui::Text("Sort keys: %d", stats.SortKeyCount);
+
+    if (ImPlot3D::BeginPlot("Depth Sorting", ImVec2(-1, 400))) {
+        ImPlot3DPlot* plot = ImPlot3D::GetCurrentPlot();
+        ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
+        ImPlot3D::PlotQuad("Floor", floor_xs, floor_ys, floor_zs, 4,
+                           {ImPlot3DProp_Flags, floor_no_sort ? ImPlot3DItemFlags_NoDepthSort : ImPlot3DItemFlags_None});
+        ImPlot3D::PlotSurface("Surface", xs, ys, zs, N, N);
+        ImPlot3D::PlotScatter("Column", cxs, cys, czs, M,
+                              {ImPlot3DProp_Flags, column_pre_sorted ? ImPlot3DItemFlags_PreSorted : ImPlot3DItemFlags_None});
+        ImPlot3D::EndPlot();
+        stats = plot->Stats;
+    }
+}
+
+void DemoTextLabels() {
+    IMGUI_DEMO_MARKER("Plots/Text Labels");
+    static int count = 10000;
+    static bool collision = true;
+    static bool depth_sort = false;
+    static ImVector<float> xs, ys, zs;
+    static ImVector<char> label_data;
+    static ImVector<const char*> labels;
+
+    ImGui::SliderInt("Count", &count, 10, 100000, "%d", ImGuiSliderFlags_Logarithmic);
+    ImGui::Checkbox("Collision Culling", &collision);
+    ImGui::SameLine();
+    HelpMarker("Skip the labels overlapping a label with a lower index.");
+    ImGui::SameLine();
+    ImGui::Checkbox("Depth Sort", &depth_sort);
+    ImGui::SameLine();
+    HelpMarker("Sort the labels with the plot geometry, so that closer triangles hide them.");
+
+    // Random points on a sphere, labeled by their index
+    if (xs.Size != count) {
+        xs.resize(count);
+        ys.resize(count);
+        zs.resize(count);
+        label_data.resize(count * 8);
+        labels.resize(count);
+        srand(0);
+        for (int i = 0; i < count; i++) {
+            const float theta = 2.0f * IM_PI * rand() / RAND_MAX;
+            const float z = -1.0f + 2.0f * rand() / RAND_MAX;
+            const float r = ImSqrt(1.0f - z * z);
+            xs[i] = r * ImCos(theta);
+            ys[i] = r * ImSin(theta);
+            zs[i] = z;
+            labels[i] = &label_data[i * 8];
+            snprintf(&label_data[i * 8], 8, "P%d", i);
+        }
+    }
+
+    ImPlot3DTextFlags flags = ImPlot3DTextFlags_None;
+    if (!collision)
+        flags |= ImPlot3DTextFlags_NoCollision;
+    if (depth_sort)
+        flags |= ImPlot3DTextFlags_DepthSort;
+
+    if (ImPlot3D::BeginPlot("Text Labels", ImVec2(-1, 400))) {
+        ImPlot3D::SetupAxesLimits(-1.2, 1.2, -1.2, 1.2, -1.2, 1.2);
+        ImPlot3D::PlotScatter("Points", xs.Data, ys.Data, zs.Data, count, {ImPlot3DProp_MarkerSize, 2.0f});
+        // Opaque plane hiding the labels behind it when depth sorted
+        static const float plane_xs[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+        static const float plane_ys[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+        static const float plane_zs[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        ImPlot3D::PlotQuad("Plane", plane_xs, plane_ys, plane_zs, 4, {ImPlot3DProp_FillAlpha, 1.0f});
+        ImPlot3D::PlotTexts(labels.Data, xs.Data, ys.Data, zs.Data, count, flags, ImVec2(0, -10));
+        ImPlot3D::EndPlot();
+    }
+}
+
 void DemoNaNValues() {
     IMGUI_DEMO_MARKER("Plots/NaN Values");
     static bool include_nan = true;
@@ -982,13 +1427,17 @@ void Demo_LogScale() {
         zs[i] = 0.0;
     }
 
+    // The data never changes, so a constant data version lets ImPlot3D cache the log-scaled coordinates
+    ImGui::BulletText("Items with a data version only compute log10 of their data when the version changes.");
+    ImPlot3DSpec spec(ImPlot3DProp_DataVersion, 0);
+
     if (ImPlot3D::BeginPlot("Log Plot 3D", ImVec2(-1, 0))) {
         ImPlot3D::SetupAxisScale(ImAxis3D_X, ImPlot3DScale_Log10);
         ImPlot3D::SetupAxesLimits(0.1, 100, 0, 10, -1, 1);
-        ImPlot3D::PlotLine("f(x) = x", xs, xs, zs, 1001);
-        ImPlot3D::PlotLine("f(x) = sin(x)+1", xs, ys1, zs, 1001);
-        ImPlot3D::PlotLine("f(x) = log(x)", xs, ys2, zs, 1001);
-        ImPlot3D::PlotLine("f(x) = 10^x", xs, ys3, zs, 21);
+        ImPlot3D::PlotLine("f(x) = x", xs, xs, zs, 1001, spec);
+        ImPlot3D::PlotLine("f(x) = sin(x)+1", xs, ys1, zs, 1001, spec);
+        ImPlot3D::PlotLine("f(x) = log(x)", xs, ys2, zs, 1001, spec);
+        ImPlot3D::PlotLine("f(x) = 10^x", xs, ys3, zs, 21, spec);
         ImPlot3D::EndPlot();
     }
 }
@@ -1010,6 +1459,31 @@ void Demo_SymmetricLogScale() {
     }
 }
 
+// Square root axis scale. The batched version is optional, it lets ImPlot3D transform cached item data without a call per value
+static double TransformForward_Sqrt(double v, void*) { return v > 0.0 ? sqrt(v) : 0.0; }
+static double TransformInverse_Sqrt(double v, void*) { return v * v; }
+static void TransformForwardBatch_Sqrt(const double* values, double* out, int count, void*) {
+    for (int i = 0; i < count; i++)
+        out[i] = sqrt(values[i] > 0.0 ? values[i] : 0.0);
+}
+
+void Demo_CustomScale() {
+    IMGUI_DEMO_MARKER("Axes/Custom Scale");
+    static double xs[1001], ys[1001], zs[1001];
+    for (int i = 0; i < 1001; i++) {
+        xs[i] = i * 0.1;
+        ys[i] = sin(xs[i]);
+        zs[i] = xs[i] * xs[i];
+    }
+    ImGui::BulletText("The Z axis uses a custom square root scale with a batched forward transform.");
+    if (ImPlot3D::BeginPlot("Custom Scale Plot", ImVec2(-1, 0))) {
+        ImPlot3D::SetupAxisScale(ImAxis3D_Z, TransformForward_Sqrt, TransformInverse_Sqrt, nullptr, TransformForwardBatch_Sqrt);
+        ImPlot3D::SetupAxesLimits(0, 100, -1, 1, 0, 10000);
+        ImPlot3D::PlotLine("f(x) = x^2", xs, ys, zs, 1001, ImPlot3DSpec(ImPlot3DProp_DataVersion, 0));
+        ImPlot3D::EndPlot();
+    }
+}
+
 void DemoTickLabels() {
     IMGUI_DEMO_MARKER("Axes/Tick Labels");
     static bool custom_fmt = true;
@@ -1253,28 +1727,44 @@ void DemoCustomStyles() {
 
 void DemoCustomRendering() {
     IMGUI_DEMO_MARKER("Custom/Custom Rendering");
+    ImGui::BulletText("GetPlotDrawList() draws 2D shapes, which are not depth sorted (yellow circle).");
+    ImGui::BulletText("AddTriangles3D() and AddLines3D() draw 3D geometry depth sorted with the plot items (pyramid and box).");
     if (ImPlot3D::BeginPlot("##CustomRend")) {
         ImPlot3D::SetupAxesLimits(-0.1, 1.1, -0.1, 1.1, -0.1, 1.1);
 
-        // Draw circle
-        ImVec2 cntr = ImPlot3D::PlotToPixels(ImPlot3DPoint(0.5, 0.5, 0.5));
-        ImPlot3D::GetPlotDrawList()->AddCircleFilled(cntr, 20, IM_COL32(255, 255, 0, 255), 20);
+        // Draw pyramid spinning around its axis. Its points are rotated all at once around the origin, then moved to the center of the box
+        const ImPlot3DPoint center(0.5, 0.5, 0.5);
+        ImPlot3DPoint pts[5] = {ImPlot3DPoint(0.0, 0.0, 0.4), ImPlot3DPoint(-0.3, -0.3, -0.4), ImPlot3DPoint(0.3, -0.3, -0.4),
+                                ImPlot3DPoint(0.3, 0.3, -0.4), ImPlot3DPoint(-0.3, 0.3, -0.4)};
+        ImPlot3DQuat(ImGui::GetTime(), ImPlot3DPoint(0.0, 0.0, 1.0)).Rotate(pts, pts, 5);
+        for (int i = 0; i < 5; i++)
+            pts[i] += center;
+        const ImU32 face_cols[4] = {IM_COL32(255, 80, 80, 255), IM_COL32(80, 255, 80, 255), IM_COL32(80, 80, 255, 255), IM_COL32(255, 255, 80, 255)};
+        for (int i = 0; i < 4; i++) {
+            const ImPlot3DPoint face[3] = {pts[1 + i], pts[1 + (i + 1) % 4], pts[0]};
+            ImPlot3D::AddTriangles3D(face, 3, face_cols[i]);
+        }
 
         // Draw box
         ImPlot3DPoint corners[8] = {
             ImPlot3DPoint(0, 0, 0), ImPlot3DPoint(1, 0, 0), ImPlot3DPoint(1, 1, 0), ImPlot3DPoint(0, 1, 0),
             ImPlot3DPoint(0, 0, 1), ImPlot3DPoint(1, 0, 1), ImPlot3DPoint(1, 1, 1), ImPlot3DPoint(0, 1, 1),
         };
-        ImVec2 corners_px[8];
-        for (int i = 0; i < 8; i++)
-            corners_px[i] = ImPlot3D::PlotToPixels(corners[i]);
-
-        ImU32 col = IM_COL32(128, 0, 255, 255);
+        ImPlot3DPoint edges[24];
         for (int i = 0; i < 4; i++) {
-            ImPlot3D::GetPlotDrawList()->AddLine(corners_px[i], corners_px[(i + 1) % 4], col);
-            ImPlot3D::GetPlotDrawList()->AddLine(corners_px[i + 4], corners_px[(i + 1) % 4 + 4], col);
-            ImPlot3D::GetPlotDrawList()->AddLine(corners_px[i], corners_px[i + 4], col);
+            edges[i * 6 + 0] = corners[i];
+            edges[i * 6 + 1] = corners[(i + 1) % 4];
+            edges[i * 6 + 2] = corners[i + 4];
+            edges[i * 6 + 3] = corners[(i + 1) % 4 + 4];
+            edges[i * 6 + 4] = corners[i];
+            edges[i * 6 + 5] = corners[i + 4];
         }
+        ImPlot3D::AddLines3D(edges, 24, IM_COL32(128, 0, 255, 255), 2.0f);
+
+        // Draw circle
+        ImVec2 cntr = ImPlot3D::PlotToPixels(ImPlot3DPoint(0.5, 0.5, 0.5));
+        ImPlot3D::GetPlotDrawList()->AddCircleFilled(cntr, 20, IM_COL32(255, 255, 0, 255), 20);
+
         ImPlot3D::EndPlot();
     }
 }
@@ -1507,6 +1997,178 @@ void DemoCustomPerPointStyle() {
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Performance
+//-----------------------------------------------------------------------------
+
+void DemoStressTest() {
+    IMGUI_DEMO_MARKER("Performance/Stress Test");
+    enum ItemType { ItemType_Scatter, ItemType_Line, ItemType_Triangle, ItemType_Quad, ItemType_Surface, ItemType_COUNT };
+    static const char* item_names[] = {"Scatter", "Line", "Triangle", "Quad", "Surface"};
+    static int item_type = ItemType_Scatter;
+    static int count = 100000;
+    static bool sprite_markers = false;
+    static bool data_version = true;
+    static bool item_bounds = false;
+    static bool symlog = false;
+    static bool rotate = false;
+    static bool interactive_lod = false;
+    static int lod_point_budget = 100000;
+    static int lod_tri_budget = 400000;
+    static bool progressive = false;
+    static int progressive_budget = 200000;
+    static float progressive_time = 0.0f;
+    static float progress = 0.0f;
+    static ImVector<float> xs, ys, zs;
+    static int data_type = -1, data_count = -1;
+    static ImPlot3DBox data_bounds;
+    static ImPlot3DPlotStats stats;
+
+    ImGui::Combo("Item Type", &item_type, item_names, ItemType_COUNT);
+    ImGui::SliderInt("Count", &count, 1000, 10000000, "%d", ImGuiSliderFlags_Logarithmic);
+    ImGui::SameLine();
+    HelpMarker("Number of points for scatter and line plots, of vertices for triangle and quad plots, and of grid points for surface plots.");
+    ImGui::Checkbox("Sprite Markers", &sprite_markers);
+    ImGui::SameLine();
+    HelpMarker("Render each marker as a single textured quad from the font atlas.");
+    ImGui::SameLine();
+    ImGui::Checkbox("Data Version", &data_version);
+    ImGui::SameLine();
+    HelpMarker("Tell ImPlot3D the data does not change, so that scaled coordinates and the data bounds are cached between frames.");
+    ImGui::SameLine();
+    ImGui::Checkbox("Item Bounds", &item_bounds);
+    ImGui::SameLine();
+    HelpMarker("Tell ImPlot3D the bounds of the data. Items fully inside the plot box are rendered without culling each primitive, and items "
+               "fully outside are skipped. Without a data version, the bounds are otherwise only known when the plot is fitted.");
+    ImGui::SameLine();
+    ImGui::Checkbox("SymLog Axes", &symlog);
+    ImGui::SameLine();
+    ImGui::Checkbox("Rotate", &rotate);
+    ImGui::Checkbox("Interactive LOD", &interactive_lod);
+    ImGui::SameLine();
+    HelpMarker("Render a subset of the data while the plot is rotated or panned with the mouse, full quality returns on release.");
+    if (interactive_lod) {
+        ImGui::SliderInt("Point Budget", &lod_point_budget, 1000, 1000000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SliderInt("Triangle Budget", &lod_tri_budget, 1000, 4000000, "%d", ImGuiSliderFlags_Logarithmic);
+    }
+    ImGui::Checkbox("Progressive", &progressive);
+    ImGui::SameLine();
+    HelpMarker("Generate at most a budget of primitives per frame and keep refining the plot over the next frames while the view doesn't "
+               "change. Requires Data Version.");
+    if (progressive) {
+        ImGui::SliderInt("Primitive Budget", &progressive_budget, 1000, 1000000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SliderFloat("Time Budget", &progressive_time, 0.0f, 20.0f, progressive_time > 0.0f ? "%.1f ms" : "No limit");
+        ImGui::ProgressBar(progress, ImVec2(-1, 0));
+    }
+
+    // Generate the data only when the item type or count changes
+    if (data_type != item_type || data_count != count) {
+        data_type = item_type;
+        data_count = count;
+        int n = count;
+        if (item_type == ItemType_Triangle)
+            n -= n % 3;
+        else if (item_type == ItemType_Quad)
+            n -= n % 4;
+        xs.resize(n);
+        ys.resize(n);
+        zs.resize(n);
+        srand(0);
+        if (item_type == ItemType_Surface) {
+            const int side = (int)sqrt((double)count);
+            xs.resize(side * side);
+            ys.resize(side * side);
+            zs.resize(side * side);
+            for (int i = 0; i < side; i++) {
+                for (int j = 0; j < side; j++) {
+                    const int idx = i * side + j;
+                    xs[idx] = -1.0f + 2.0f * j / (side - 1);
+                    ys[idx] = -1.0f + 2.0f * i / (side - 1);
+                    zs[idx] = sinf(6.0f * xs[idx]) * cosf(6.0f * ys[idx]);
+                }
+            }
+        } else if (item_type == ItemType_Line) {
+            for (int i = 0; i < n; i++) {
+                const float t = 20.0f * 3.14159265f * i / n;
+                xs[i] = cosf(t) * (1.0f - (float)i / n);
+                ys[i] = sinf(t) * (1.0f - (float)i / n);
+                zs[i] = -1.0f + 2.0f * i / n;
+            }
+        } else {
+            // Random points, triangle and quad vertices scattered around random centers
+            const int vtx_per_prim = item_type == ItemType_Triangle ? 3 : item_type == ItemType_Quad ? 4 : 1;
+            const float prim_size = 0.05f;
+            for (int i = 0; i < n; i += vtx_per_prim) {
+                const float cx = -1.0f + 2.0f * rand() / RAND_MAX;
+                const float cy = -1.0f + 2.0f * rand() / RAND_MAX;
+                const float cz = -1.0f + 2.0f * rand() / RAND_MAX;
+                for (int v = 0; v < vtx_per_prim; v++) {
+                    xs[i + v] = cx + (vtx_per_prim > 1 ? prim_size * rand() / RAND_MAX : 0.0f);
+                    ys[i + v] = cy + (vtx_per_prim > 1 ? prim_size * rand() / RAND_MAX : 0.0f);
+                    zs[i + v] = cz + (vtx_per_prim > 1 ? prim_size * rand() / RAND_MAX : 0.0f);
+                }
+            }
+        }
+        data_bounds = ImPlot3DBox(ImPlot3DPoint(HUGE_VAL, HUGE_VAL, HUGE_VAL), ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL));
+        for (int i = 0; i < xs.Size; i++)
+            data_bounds.Expand(ImPlot3DPoint(xs[i], ys[i], zs[i]));
+    }
+
+    // Statistics of the last frame
+    const ImGuiIO& io = ImGui::GetIO();
+    ImGui::Text("Frame: %.3f ms (%.1f FPS) | Sort: %.3f ms", 1000.0f / io.Framerate, io.Framerate, stats.SortTime);
+    ImGui::Text("Vertices: %d | Triangles: %d | Sort keys: %d | Frame arena: %.1f KB", stats.VtxCount, stats.TriCount, stats.SortKeyCount,
+                ImPlot3D::GetCurrentContext()->FrameArena.Capacity / 1024.0);
+    ImGui::Text("Primitives: %d rendered (%d unclipped), %d culled, %d dropped", stats.PrimsRendered, stats.PrimsUnclipped, stats.PrimsCulled,
+                stats.PrimsDropped);
+    ImGui::Text("Requested: %d points, %d triangles | Triangles dropped: %d", stats.PointsRequested, stats.TrisRequested, stats.TrisDropped);
+    if (stats.PrimsDropped > 0 || stats.TrisDropped > 0) {
+        ImGui::SameLine();
+        HelpMarker("Primitives and triangles are dropped once the draw list runs out of indices. Define ImDrawIdx as unsigned int in imconfig.h "
+                   "to render more.");
+    }
+
+    ImPlot3DSpec spec;
+    spec.Flags = sprite_markers ? ImPlot3DItemFlags_SpriteMarkers : ImPlot3DItemFlags_None;
+    spec.DataVersion = data_version ? data_count : -1;
+    spec.Bounds = item_bounds ? &data_bounds : nullptr;
+    if (item_type == ItemType_Scatter)
+        spec.MarkerSize = 2;
+
+    ImPlot3DFlags flags = ImPlot3DFlags_None;
+    if (interactive_lod)
+        flags |= ImPlot3DFlags_InteractiveLOD;
+    if (progressive)
+        flags |= ImPlot3DFlags_Progressive;
+    if (ImPlot3D::BeginPlot("Stress Test", ImVec2(-1, 400), flags)) {
+        ImPlot3DPlot* plot = ImPlot3D::GetCurrentPlot();
+        ImPlot3D::SetupAxesLimits(-1.1, 1.1, -1.1, 1.1, -1.1, 1.1, ImPlot3DCond_Always);
+        ImPlot3D::SetupInteractiveLOD(lod_point_budget, lod_tri_budget);
+        ImPlot3D::SetupProgressive(progressive_budget, progressive_time);
+        if (symlog) {
+            ImPlot3D::SetupAxisScale(ImAxis3D_X, ImPlot3DScale_SymLog);
+            ImPlot3D::SetupAxisScale(ImAxis3D_Y, ImPlot3DScale_SymLog);
+            ImPlot3D::SetupAxisScale(ImAxis3D_Z, ImPlot3DScale_SymLog);
+        }
+        if (rotate)
+            ImPlot3D::SetupBoxRotation(20.0, fmod(ImGui::GetTime() * 20.0, 360.0), false, ImPlot3DCond_Always);
+        switch (item_type) {
+            case ItemType_Scatter: ImPlot3D::PlotScatter("Scatter", xs.Data, ys.Data, zs.Data, xs.Size, spec); break;
+            case ItemType_Line: ImPlot3D::PlotLine("Line", xs.Data, ys.Data, zs.Data, xs.Size, spec); break;
+            case ItemType_Triangle: ImPlot3D::PlotTriangle("Triangle", xs.Data, ys.Data, zs.Data, xs.Size, spec); break;
+            case ItemType_Quad: ImPlot3D::PlotQuad("Quad", xs.Data, ys.Data, zs.Data, xs.Size, spec); break;
+            case ItemType_Surface: {
+                const int side = (int)sqrt((double)xs.Size);
+                ImPlot3D::PlotSurface("Surface", xs.Data, ys.Data, zs.Data, side, side, 0.0, 0.0, spec);
+                break;
+            }
+        }
+        ImPlot3D::EndPlot();
+        stats = plot->Stats;
+        progress = plot->Progressive.GetProgress();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Config
 //-----------------------------------------------------------------------------
@@ -1630,12 +2292,18 @@ void ShowAllDemos() {
             // Plot Types
             ImGui::SeparatorText("Plot Types");
             DemoHeader("Line Plots", DemoLinePlots);
+            DemoHeader("Colored Lines", DemoColoredLines);
+            DemoHeader("Tubes", DemoTubes);
             DemoHeader("Scatter Plots", DemoScatterPlots);
             DemoHeader("Triangle Plots", DemoTrianglePlots);
             DemoHeader("Quad Plots", DemoQuadPlots);
             DemoHeader("Surface Plots", DemoSurfacePlots);
+            DemoHeader("Waterfall Plots", DemoWaterfallPlots);
+            DemoHeader("Heatmap Plots", DemoHeatmap3D);
             DemoHeader("Mesh Plots", DemoMeshPlots);
+            DemoHeader("Instanced Meshes", DemoInstancedMeshes);
             DemoHeader("Realtime Plots", DemoRealtimePlots);
+            DemoHeader("Scrolling Surface", DemoScrollingSurface);
             DemoHeader("Image Plots", DemoImagePlots);
 
             // Plot Options
@@ -1644,6 +2312,8 @@ void ShowAllDemos() {
             DemoHeader("Offset and Stride", DemoOffsetAndStride);
             DemoHeader("Legend Options", DemoLegendOptions);
             DemoHeader("Markers and Text", DemoMarkersAndText);
+            DemoHeader("Text Labels", DemoTextLabels);
+            DemoHeader("Depth Sorting", DemoDepthSorting);
             DemoHeader("NaN Values", DemoNaNValues);
             ImGui::EndTabItem();
         }
@@ -1652,6 +2322,7 @@ void ShowAllDemos() {
             DemoHeader("Box Rotation", DemoBoxRotation);
             DemoHeader("Log Scale", Demo_LogScale);
             DemoHeader("Symmetric Log Scale", Demo_SymmetricLogScale);
+            DemoHeader("Custom Scale", Demo_CustomScale);
             DemoHeader("Tick Labels", DemoTickLabels);
             DemoHeader("Axis Constraints", DemoAxisConstraints);
             DemoHeader("Equal Axes", DemoEqualAxes);
@@ -1669,6 +2340,10 @@ void ShowAllDemos() {
             DemoHeader("Custom Per-Point Style", DemoCustomPerPointStyle);
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("Performance")) {
+            DemoHeader("Stress Test", DemoStressTest);
+            ImGui::EndTabItem();
+        }
         if (ImGui::BeginTabItem("Config")) {
             DemoConfig();
             ImGui::EndTabItem();
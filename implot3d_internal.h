@@ -118,6 +118,13 @@ template <typename T> void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax)
 // [SECTION] Internal Enumerations
 //-----------------------------------------------------------------------------
 
+// How the depth keys added to an ImDrawList3D are ordered (see ImDrawList3D::SetSortMode)
+enum ImDrawList3DSortMode_ {
+    ImDrawList3DSortMode_Sorted,    // Keys are sorted by depth (default)
+    ImDrawList3DSortMode_PreSorted, // Keys are already in back to front order and are merged with the sorted ones
+    ImDrawList3DSortMode_Unsorted,  // Keys are drawn behind all the others, in submission order
+};
+
 enum ImPlot3DMarkerInternal_ {
     ImPlot3DMarker_Invalid = -3,
 };
@@ -145,41 +152,110 @@ struct ImDrawList3D {
         unsigned int VtxIdx;
     };
 
-    ImVector<ImDrawIdx> IdxBuffer;  // Index buffer
-    ImVector<ImDrawVert> VtxBuffer; // Vertex buffer
-    ImVector<double> ZBuffer;       // Z buffer. Depth value for each triangle
-    unsigned int _VtxCurrentIdx;    // [Internal] current vertex index
-    ImDrawVert* _VtxWritePtr; // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
+    // [Internal] Define the UV and color of the vertices starting at VtxIdx. They are only combined with the positions into ImDrawVert when
+    // moving the triangles to the ImGui draw list, so renderers only write what varies per vertex
+    struct ImVtxStyleBufferItem {
+        unsigned int VtxIdx; // First vertex using this style
+        int ColOffset;       // Index in ColBuffer of the color of the first vertex, or -1 if all vertices use Col
+        ImU32 Col;           // Color of all vertices (if ColOffset == -1)
+        int UVCount;         // 1 if all vertices use UV[0], 4 if UV[i] is used by every 4th vertex starting at VtxIdx + i
+        ImVec2 UV[4];        // Texture coordinates
+    };
+
+    // [Internal] Define the triangles of the depth keys starting at KeyIdx and how their indices are obtained
+    struct ImPrimBufferItem {
+        unsigned int KeyIdx; // First depth key of the run
+        unsigned int VtxIdx; // First vertex of the run
+        int FanVtxCount;     // Number of vertices of each triangle fan, or 0 if the indices are stored in IdxBuffer
+        int KeyTriCount;     // Number of triangles sorted with each depth key
+        int IdxOffset;       // Index in IdxBuffer of the first index of the run (if FanVtxCount == 0)
+    };
+
+    // [Internal] Define how the depth keys starting at KeyIdx are ordered
+    struct ImSortModeBufferItem {
+        unsigned int KeyIdx; // First depth key using this mode
+        int Mode;            // ImDrawList3DSortMode_
+    };
+
+    // [Internal] Primitive being sorted by SortedMoveToImGuiDrawList
+    struct ImPrimSortItem {
+        double Z;   // Depth key
+        int KeyIdx; // Index of the depth key in ZBuffer
+        int Run;    // Index of the run of the primitive in _PrimBuffer
+    };
+
+    ImVector<ImDrawIdx> IdxBuffer; // Index buffer. Only holds the triangles of runs with explicit indices
+    ImVector<ImVec2> PosBuffer;    // Vertex position buffer
+    ImVector<ImU32> ColBuffer;     // Vertex color buffer. Only holds the vertices of styles with per-vertex colors
+    ImVector<double> ZBuffer;      // Z buffer. Depth key of each primitive (e.g. quad, line segment, marker) or triangle
+    unsigned int _VtxCurrentIdx;   // [Internal] current vertex index
+    ImVec2* _PosWritePtr;     // [Internal] point within PosBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
+    ImU32* _ColWritePtr;      // [Internal] point within ColBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx* _IdxWritePtr;  // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     double* _ZWritePtr;       // [Internal] point within ZBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawListFlags _Flags;   // [Internal] draw list flags
-    ImVector<ImTextureBufferItem> _TextureBuffer; // [Internal] buffer for SetTexture/ResetTexture
-    ImDrawListSharedData* _SharedData;            // [Internal] shared draw list data
+    ImVector<ImTextureBufferItem> _TextureBuffer;   // [Internal] buffer for SetTexture/ResetTexture
+    ImVector<ImVtxStyleBufferItem> _VtxStyleBuffer; // [Internal] buffer for SetVtxStyle
+    ImVector<ImPrimBufferItem> _PrimBuffer;         // [Internal] buffer for SetPrimFan
+    ImVector<ImPrimSortItem> _SortBuffer;           // [Internal] sorted primitives kept by SortedMoveToImGuiDrawList(true)
+    ImVector<ImSortModeBufferItem> _SortModeBuffer; // [Internal] buffer for SetSortMode, empty if all the keys are sorted
+    int _SortKeyCount;                              // [Internal] number of depth keys sorted by the last SortedMoveToImGuiDrawList call
+    ImDrawListSharedData* _SharedData;              // [Internal] shared draw list data
 
     ImDrawList3D() {
         _Flags = ImDrawListFlags_None;
         _SharedData = nullptr;
+        _SortKeyCount = 0;
         ResetBuffers();
     }
 
+    // Reserves #idx_count / 3 triangles and #vtx_count vertices. Indices are only reserved if the triangles have explicit indices, depth keys
+    // according to the current fan and vertex colors if the current style has per-vertex colors, so SetPrimFan and SetVtxStyle must be
+    // called before reserving
     void PrimReserve(int idx_count, int vtx_count);
     void PrimUnreserve(int idx_count, int vtx_count);
 
     void SetTexture(ImTextureRef tex_ref);
     void ResetTexture();
 
-    void SortedMoveToImGuiDrawList();
+    // Sets the color and texture coordinates of the vertices added from now on. #uvs holds #uv_count (1 or 4) texture coordinates, with 4 they
+    // are repeated every 4 vertices (e.g. textured quads or anti-aliased lines)
+    void SetVtxStyle(ImU32 col, const ImVec2* uvs, int uv_count = 1);
+    // Same as above, but the color of each vertex is written to _ColWritePtr
+    void SetVtxStyle(const ImVec2* uvs, int uv_count = 1);
+
+    // Sets how the indices of the triangles added from now on are obtained. With #fan_vtx_count >= 3, vertices are grouped in fans of
+    // #fan_vtx_count vertices forming the triangles (0, i - 1, i), and indices are generated while sorting (e.g. 3 for triangles, 4 for quads).
+    // Each fan is sorted as a whole with a single depth key, or with one key per triangle if #key_per_tri is set (e.g. non-planar quads).
+    // With 0, the indices are written to _IdxWritePtr and each triangle has its own depth key
+    void SetPrimFan(int fan_vtx_count, bool key_per_tri = false);
+
+    // Sets how the depth keys added from now on are ordered (ImDrawList3DSortMode_). Each call with ImDrawList3DSortMode_PreSorted starts a new
+    // back to front sequence. Must be called before reserving
+    void SetSortMode(int mode);
 
+    // Sorts the primitives by depth and moves them to the current window draw list. Returns the number of triangles dropped because they did
+    // not fit in the remaining ImDrawIdx range. With #retain, the buffers are copied instead and kept for the next call, which then only sorts
+    // the primitives added in between
+    int SortedMoveToImGuiDrawList(bool retain = false);
+
+    // Empties the buffers, keeping their capacity so that steady-state frames don't allocate
     void ResetBuffers() {
-        IdxBuffer.clear();
-        VtxBuffer.clear();
-        ZBuffer.clear();
+        IdxBuffer.shrink(0);
+        PosBuffer.shrink(0);
+        ColBuffer.shrink(0);
+        ZBuffer.shrink(0);
         _VtxCurrentIdx = 0;
-        _VtxWritePtr = VtxBuffer.Data;
+        _PosWritePtr = PosBuffer.Data;
+        _ColWritePtr = ColBuffer.Data;
         _IdxWritePtr = IdxBuffer.Data;
         _ZWritePtr = ZBuffer.Data;
-        _TextureBuffer.clear();
+        _TextureBuffer.shrink(0);
         ResetTexture();
+        _VtxStyleBuffer.shrink(0);
+        _PrimBuffer.shrink(0);
+        _SortBuffer.shrink(0);
+        _SortModeBuffer.shrink(0);
     }
 
     constexpr static unsigned int MaxIdx() { return sizeof(ImDrawIdx) == 2 ? 65535 : 4294967295; }
@@ -194,6 +270,8 @@ struct ImPlot3DNextItemData {
     bool IsAutoFill;
     bool IsAutoLine;
     bool Hidden;
+    ImPlot3DBox Bounds; // Bounds of the current item data in plot coordinates (see BeginItemEx)
+    bool HasBounds;     // Whether the bounds are known, otherwise each primitive is culled
 
     ImPlot3DNextItemData() { Reset(); }
 
@@ -206,6 +284,7 @@ struct ImPlot3DNextItemData {
         IsAutoFill = true;
         IsAutoLine = true;
         Hidden = false;
+        HasBounds = false;
     }
 };
 
@@ -325,6 +404,10 @@ struct ImPlot3DItem {
     bool Show;
     bool LegendHovered;
     bool SeenThisFrame;
+    ImPlot3DBox Bounds; // Bounds of the item data, cached for its data version (see BeginItemEx)
+    int BoundsVersion;  // Data version the bounds were computed for, -1 if not cached
+    int BoundsCount;    // Number of points the bounds were computed for
+    bool BoundsValid;   // False if the data has NaN values, so that the bounds can't be used for culling
 
     ImPlot3DItem() {
         ID = 0;
@@ -334,6 +417,9 @@ struct ImPlot3DItem {
         Show = true;
         LegendHovered = false;
         SeenThisFrame = false;
+        BoundsVersion = -1;
+        BoundsCount = 0;
+        BoundsValid = false;
     }
     ~ImPlot3DItem() { ID = 0; }
 };
@@ -362,9 +448,181 @@ struct ImPlot3DLegend {
     }
 };
 
+// Row storage and cached projections for PlotWaterfall
+struct ImPlot3DWaterfall {
+    int BinCount;                 // Number of values per row
+    int RowCapacity;              // Maximum number of rows stored
+    int RowCount;                 // Number of rows currently stored
+    int RowHead;                  // Ring slot where the next row will be written
+    double XMin, XMax;            // X range the bins are spread over
+    double RowStep;               // Y distance between consecutive rows
+    unsigned int Version;         // Incremented when the rows or their placement change, used as the data version of the item
+    ImVector<double> Xs;          // X position of each bin
+    ImVector<double> Values;      // Row values (RowCapacity * BinCount)
+    ImVector<double> RowMin;      // Minimum value of each row slot
+    ImVector<double> RowMax;      // Maximum value of each row slot
+    ImVector<ImVec2> PixPos;      // Cached pixel position of each value, projected with the row at Y = 0
+    ImVector<double> PixDepth;    // Cached depth of each value, projected with the row at Y = 0
+    ImVector<ImU32> Colors;       // Cached colormap color of each value
+    ImVector<bool> RowProjected;  // True if the row slot has valid cached projections
+    ImVector<bool> RowColored;    // True if the row slot has valid cached colors
+    ImVector<ImVec2> RowPixShift; // Per-frame pixel shift of each row (indexed by row age)
+    ImVector<double> RowZShift;   // Per-frame depth shift of each row (indexed by row age)
+    // View used for the cached projections
+    ImPlot3DQuat ViewRotation;
+    ImRect ViewRect;
+    float ViewScale;
+    ImPlot3DRange ViewRanges[3];
+    double ViewNDCScales[3];
+    ImPlot3DAxisFlags ViewFlags[3];
+    ImPlot3DTransform ViewTransforms[3];
+    void* ViewTransformData[3];
+    // Colormap used for the cached colors
+    ImPlot3DColormap ColorMap;
+    double ColorMin, ColorMax;
+    float ColorAlpha;
+
+    ImPlot3DWaterfall() {
+        BinCount = RowCapacity = RowCount = RowHead = 0;
+        XMin = XMax = 0.0;
+        RowStep = 0.0;
+        Version = 0;
+        ViewScale = 0.0f;
+        for (int i = 0; i < 3; i++) {
+            ViewNDCScales[i] = 0.0;
+            ViewFlags[i] = ImPlot3DAxisFlags_None;
+            ViewTransforms[i] = nullptr;
+            ViewTransformData[i] = nullptr;
+        }
+        ColorMap = -1;
+        ColorMin = ColorMax = 0.0;
+        ColorAlpha = 0.0f;
+    }
+
+    // Clears the history and resizes the ring for rows of #bin_count values
+    void Reset(int bin_count, int row_capacity) {
+        BinCount = bin_count;
+        RowCapacity = row_capacity;
+        RowCount = RowHead = 0;
+        Values.resize(bin_count * row_capacity);
+        PixPos.resize(bin_count * row_capacity);
+        PixDepth.resize(bin_count * row_capacity);
+        Colors.resize(bin_count * row_capacity);
+        RowMin.resize(row_capacity);
+        RowMax.resize(row_capacity);
+        RowProjected.resize(row_capacity);
+        RowColored.resize(row_capacity);
+        RowPixShift.resize(row_capacity);
+        RowZShift.resize(row_capacity);
+        Xs.resize(bin_count);
+        XMin = XMax = NAN; // Forces the bin positions to be recomputed
+        Version++;
+    }
+
+    // Returns the ring slot of the row with the given age (0 is the newest row)
+    inline int GetSlot(int age) const { return ImPlot3D::ImPosMod(RowHead - 1 - age, RowCapacity); }
+    inline double GetValue(int age, int bin) const { return Values[GetSlot(age) * BinCount + bin]; }
+
+    inline void InvalidateProjections() {
+        for (int i = 0; i < RowProjected.Size; i++)
+            RowProjected[i] = false;
+    }
+    inline void InvalidateColors() {
+        for (int i = 0; i < RowColored.Size; i++)
+            RowColored[i] = false;
+    }
+};
+
+// Item coordinates transformed by the axis scales, reused while the data version and the scales don't change
+struct ImPlot3DScaledPoints {
+    ImVector<ImPlot3DPoint> Points;  // Scaled coordinates
+    int DataVersion;                 // Data version the points were computed for
+    ImPlot3DTransform Transforms[3]; // Forward transform of each axis
+    void* TransformData[3];          // Transform data of each axis
+
+    ImPlot3DScaledPoints() {
+        DataVersion = -1;
+        for (int i = 0; i < 3; i++) {
+            Transforms[i] = nullptr;
+            TransformData[i] = nullptr;
+        }
+    }
+};
+
+// Swept geometry of PlotTube. The frames are computed again only when the data changes, and the rings when the frames, the radius or the number
+// of vertices per ring change, so rotating the plot only projects the cached rings
+struct ImPlot3DTube {
+    ImVector<ImPlot3DPoint> Points;     // Path points, in plot coordinates
+    ImVector<ImPlot3DPoint> Normals;    // Normal of the parallel-transport frame at each point
+    ImVector<ImPlot3DPoint> Binormals;  // Binormal of the parallel-transport frame at each point
+    ImVector<ImPlot3DPoint> Vertices;   // Cross-section rings (RingSize vertices per point), in plot coordinates
+    ImVector<ImPlot3DPoint> VtxNormals; // Surface normal at each ring vertex, for shading
+    int DataVersion;                    // Data version the frames were computed for
+    int RingSize;                       // Number of vertices per ring
+    bool Ribbon;                        // True if the rings are ribbon cross-sections
+    double Radius;                      // Radius the rings were computed for
+    int SpecVersion;                    // Last data version passed to PlotTube
+    double SpecRadius;                  // Last radius passed to PlotTube
+    unsigned int ItemVersion;           // Data version of the item, changes with SpecVersion and SpecRadius
+
+    ImPlot3DTube() {
+        DataVersion = -1;
+        RingSize = 0;
+        Ribbon = false;
+        Radius = 0.0;
+        SpecVersion = -1;
+        SpecRadius = 0.0;
+        ItemVersion = 0;
+    }
+};
+
+// Colormapped pixels (and texture, if supported) for PlotHeatmap3D
+struct ImPlot3DHeatmap {
+    ImVector<ImU32> Pixels; // Colormapped values, used when textures are not supported
+#ifdef IMGUI_HAS_TEXTURES
+    ImTextureData* Texture; // Dynamic texture holding the colormapped values
+#endif
+    // Inputs used for the current pixels
+    const void* Data;
+    int Rows, Cols;
+    int DataVersion;
+    double ScaleMin, ScaleMax;
+    ImPlot3DColormap Colormap;
+    float Alpha;
+
+    ImPlot3DHeatmap() {
+#ifdef IMGUI_HAS_TEXTURES
+        Texture = nullptr;
+#endif
+        Data = nullptr;
+        Rows = Cols = 0;
+        DataVersion = -1;
+        ScaleMin = ScaleMax = 0.0;
+        Colormap = -1;
+        Alpha = 0.0f;
+    }
+    ~ImPlot3DHeatmap();
+};
+
+#ifdef IMGUI_HAS_TEXTURES
+// Pre-rendered marker shape stored as a custom rect in the font atlas (see ImPlot3DItemFlags_SpriteMarkers)
+struct ImPlot3DMarkerSprite {
+    ImPlot3DMarker Marker;    // Marker shape
+    bool Outline;             // True for the marker outline, false for the marker fill
+    float Size;               // Marker size in pixels
+    float Weight;             // Outline weight in pixels (0 for fills)
+    ImFontAtlasRectId RectId; // Custom rect holding the sprite pixels
+    int LastFrameUsed;        // Last frame the sprite was drawn, used to evict the least recently used sprite
+};
+#endif
+
 // Holds items
 struct ImPlot3DItemGroup {
     ImPool<ImPlot3DItem> ItemPool;
+    ImPool<ImPlot3DWaterfall> WaterfallPool;
+    ImPool<ImPlot3DHeatmap> HeatmapPool;
+    ImPool<ImPlot3DScaledPoints> ScaledPointsPool;
+    ImPool<ImPlot3DTube> TubePool;
     ImPlot3DLegend Legend;
     int ColormapIdx;
     ImPlot3DMarker MarkerIdx;
@@ -379,6 +637,10 @@ struct ImPlot3DItemGroup {
     ImPlot3DItem* GetItem(ImGuiID id) { return ItemPool.GetByKey(id); }
     ImPlot3DItem* GetItem(const char* label_id) { return GetItem(GetItemID(label_id)); }
     ImPlot3DItem* GetOrAddItem(ImGuiID id) { return ItemPool.GetOrAddByKey(id); }
+    ImPlot3DWaterfall* GetOrAddWaterfall(ImGuiID id) { return WaterfallPool.GetOrAddByKey(id); }
+    ImPlot3DHeatmap* GetOrAddHeatmap(ImGuiID id) { return HeatmapPool.GetOrAddByKey(id); }
+    ImPlot3DScaledPoints* GetOrAddScaledPoints(ImGuiID id) { return ScaledPointsPool.GetOrAddByKey(id); }
+    ImPlot3DTube* GetOrAddTube(ImGuiID id) { return TubePool.GetOrAddByKey(id); }
     ImPlot3DItem* GetItemByIndex(int i) { return ItemPool.GetByIndex(i); }
     int GetItemIndex(ImPlot3DItem* item) { return ItemPool.GetIndex(item); }
     int GetLegendCount() const { return Legend.Indices.size(); }
@@ -386,6 +648,10 @@ struct ImPlot3DItemGroup {
     const char* GetLegendLabel(int i) { return Legend.Labels.Buf.Data + GetLegendItem(i)->NameOffset; }
     void Reset() {
         ItemPool.Clear();
+        WaterfallPool.Clear();
+        HeatmapPool.Clear();
+        ScaledPointsPool.Clear();
+        TubePool.Clear();
         Legend.Reset();
         ColormapIdx = 0;
         MarkerIdx = 0;
@@ -475,10 +741,11 @@ struct ImPlot3DAxis {
     ImPlot3DLocator Locator;
     bool ShowDefaultTicks;
     // Scale
-    ImPlot3DTransform TransformForward; // Custom axis forward transform
-    ImPlot3DTransform TransformInverse; // Custom axis inverse transform
-    void* TransformData;                // Custom transform data set by the user
-    ImPlot3DRange ScaledRange;          // Cached scaled range values
+    ImPlot3DTransform TransformForward;           // Custom axis forward transform
+    ImPlot3DTransform TransformInverse;           // Custom axis inverse transform
+    ImPlot3DTransformBatch TransformForwardBatch; // Batched forward transform (optional)
+    void* TransformData;                          // Custom transform data set by the user
+    ImPlot3DRange ScaledRange;                    // Cached scaled range values
     // Fit data
     bool FitThisFrame;
     ImPlot3DRange FitExtents;
@@ -500,6 +767,7 @@ struct ImPlot3DAxis {
         NDCScale = 1.0;
         Scale = ImPlot3DScale_Linear;
         TransformForward = TransformInverse = nullptr;
+        TransformForwardBatch = nullptr;
         TransformData = nullptr;
         // Ticks
         Formatter = nullptr;
@@ -522,6 +790,7 @@ struct ImPlot3DAxis {
         // Scale
         Scale = ImPlot3DScale_Linear;
         TransformForward = TransformInverse = nullptr;
+        TransformForwardBatch = nullptr;
         TransformData = nullptr;
         // Ticks
         Ticker.Reset();
@@ -698,6 +967,75 @@ struct ImPlot3DAxis {
     void ApplyFit();
 };
 
+// Progress of one RenderPrimitives call of a plot with ImPlot3DFlags_Progressive. The primitives are generated in Stride interleaved passes, so
+// that the first pass is a coarse subset of the whole item
+struct ImPlot3DProgressiveCall {
+    ImGuiID ID; // Hash of the item, its render state, its data version, its number of primitives and the index of the call within the frame
+    int Count;  // Number of primitives
+    int Done;   // Number of primitives generated so far
+    int Stride; // Number of interleaved passes
+    int Pass;   // Current pass
+    int Next;   // Next primitive of the current pass
+};
+
+// Progressive refinement state of a plot (see SetupProgressive)
+struct ImPlot3DProgressive {
+    int PrimBudget;    // Maximum number of primitives generated per frame
+    double TimeBudget; // Maximum time spent generating primitives per frame (ms), 0 for no limit
+    bool Active;       // The plot draw list is retained and refined this frame
+    bool Restart;      // The data of an item changed, restart the refinement on the next frame
+    bool AllVersioned; // All the items rendered so far have a data version
+    ImGuiID ViewHash;  // Hash of the view the retained geometry was generated for
+    int CallIdx;       // Index of the next RenderPrimitives call this frame
+    int PrimCount;     // Number of primitives of all the calls of the previous frame
+    int PrimsLeft;     // Number of primitives that can still be generated this frame
+    double StartTime;  // Time the plot started generating primitives this frame (ms)
+    ImVector<ImPlot3DProgressiveCall> Calls;
+
+    ImPlot3DProgressive() {
+        PrimBudget = 200000;
+        TimeBudget = 0.0;
+        Active = Restart = false;
+        AllVersioned = true;
+        ViewHash = 0;
+        CallIdx = PrimCount = PrimsLeft = 0;
+        StartTime = 0.0;
+    }
+
+    // Returns the progress of the next RenderPrimitives call of the frame, restarting the refinement on the next frame if the call changed.
+    // #item_id also identifies the render state of the item (see GetItemRenderID)
+    ImPlot3DProgressiveCall& NextCall(ImGuiID item_id, int data_version, int count);
+    // Returns the number of primitives #call can generate this frame, its share of the budget is proportional to its size
+    int GetCallBudget(const ImPlot3DProgressiveCall& call) const;
+    // Returns true if the time budget of the frame is exhausted
+    bool IsOutOfTime() const;
+    // Returns the fraction of the primitives generated so far
+    float GetProgress() const;
+};
+
+// Rendering statistics of a plot, gathered between BeginPlot and EndPlot (e.g. for the performance demo)
+struct ImPlot3DPlotStats {
+    int PrimsRendered;   // Primitives (points, line segments, triangles, quads...) submitted to the 3D draw list
+    int PrimsCulled;     // Primitives discarded because they were outside the plot box
+    int PrimsUnclipped;  // Primitives of items fully inside the plot box, rendered without culling (also counted in PrimsRendered)
+    int PrimsDropped;    // Primitives discarded because the draw list ran out of indices (see ImDrawIdx)
+    int TrisDropped;     // Triangles discarded when moving the draw list to the ImGui draw list, as they didn't fit in the ImDrawIdx range
+    int VtxCount;        // Vertices moved to the ImGui draw list
+    int TriCount;        // Triangles moved to the ImGui draw list
+    int SortKeyCount;    // Depth keys sorted (one per quad, line segment, marker... or per triangle), excluding pre-sorted and unsorted items
+    int PointsRequested; // Points (markers) the items asked to render, before the interactive LOD
+    int TrisRequested;   // Triangles (lines and fills) the items asked to render, before the interactive LOD
+    double SortTime;     // Time spent sorting the primitives and moving them to the ImGui draw list (ms)
+
+    ImPlot3DPlotStats() { Reset(); }
+    void Reset() {
+        PrimsRendered = PrimsCulled = PrimsUnclipped = PrimsDropped = TrisDropped = 0;
+        VtxCount = TriCount = SortKeyCount = 0;
+        PointsRequested = TrisRequested = 0;
+        SortTime = 0.0;
+    }
+};
+
 // Holds plot state information that must persist after EndPlot
 struct ImPlot3DPlot {
     ImGuiID ID;
@@ -727,10 +1065,19 @@ struct ImPlot3DPlot {
     ImPlot3DPoint DragRotationAxis; // Axis of rotation for the duration of a drag
     // Fit data
     bool FitThisFrame;
+    bool PreScaled; // Points being rendered are already transformed by the axis scales (see GetScaledPoints)
     // Items
     ImPlot3DItemGroup Items;
     // 3D draw list
     ImDrawList3D DrawList;
+    ImPlot3DPlotStats Stats; // Rendering statistics of the last frame
+    // Interactive LOD
+    int LODPointBudget;    // Maximum number of points rendered while interacting (see SetupInteractiveLOD)
+    int LODTriBudget;      // Maximum number of triangles rendered while interacting
+    int LODPrevPointCount; // Points requested by the items in the previous frame
+    int LODPrevTriCount;   // Triangles requested by the items in the previous frame
+    // Progressive refinement
+    ImPlot3DProgressive Progressive;
     // Misc
     bool ContextClick; // True if context button was clicked (to distinguish from double click)
     bool OpenContextThisFrame;
@@ -752,6 +1099,9 @@ struct ImPlot3DPlot {
         HeldPlaneIdx = -1;
         DragRotationAxis = ImPlot3DPoint(0.0, 0.0, 0.0);
         FitThisFrame = true;
+        PreScaled = false;
+        LODPointBudget = LODTriBudget = 0;
+        LODPrevPointCount = LODPrevTriCount = 0;
         ContextClick = false;
         OpenContextThisFrame = false;
     }
@@ -764,6 +1114,8 @@ struct ImPlot3DPlot {
     inline bool HasTitle() const { return !Title.empty() && !ImPlot3D::ImHasFlag(Flags, ImPlot3DFlags_NoTitle); }
     inline const char* GetTitle() const { return Title.Buf.Data; }
     inline bool IsRotationLocked() const { return RotationCond == ImPlot3DCond_Always; }
+    // True while the box is held or animating with ImPlot3DFlags_InteractiveLOD, then items render a subset of their data
+    inline bool IsLODActive() const { return ImPlot3D::ImHasFlag(Flags, ImPlot3DFlags_InteractiveLOD) && (Held || AnimationTime > 0.0f); }
 
     // Extends the fit range of all three axes to include the provided point
     void ExtendFit(const ImPlot3DPoint& point);
@@ -791,6 +1143,35 @@ struct ImPlot3DPlot {
     void ApplyEqualAspect(ImAxis3D ref_axis);
 };
 
+// Bump allocator for transient allocations that only need to live until the end of the frame. It is reset at the first BeginPlot of each ImGui
+// frame. Allocations that don't fit are taken from the heap, and the arena grows to fit all of them at the next reset, so that steady-state
+// frames don't allocate
+struct ImPlot3DFrameArena {
+    char* Data;                       // Arena memory
+    size_t Capacity;                  // Size of Data in bytes
+    size_t Used;                      // Bytes allocated this frame, including overflow allocations
+    ImVector<void*> Overflow;         // Heap allocations of this frame that did not fit in Data
+    int ResetFrame;                   // ImGui frame of the last reset
+    ImPlot3DFrameAllocFunc AllocFunc; // User allocator, replaces the arena when set
+    ImPlot3DFrameResetFunc ResetFunc; // User allocator reset
+    void* UserData;                   // User allocator data
+
+    ImPlot3DFrameArena() {
+        Data = nullptr;
+        Capacity = Used = 0;
+        ResetFrame = -1;
+        AllocFunc = nullptr;
+        ResetFunc = nullptr;
+        UserData = nullptr;
+    }
+    ~ImPlot3DFrameArena();
+
+    // Returns #size bytes aligned to 16 bytes, valid until the next reset
+    void* Alloc(size_t size);
+    // Releases all allocations of the frame
+    void Reset();
+};
+
 struct ImPlot3DContext {
     ImPool<ImPlot3DPlot> Plots;
     ImPlot3DPlot* CurrentPlot;
@@ -802,6 +1183,13 @@ struct ImPlot3DContext {
     ImVector<ImGuiStyleMod> StyleModifiers;
     ImVector<ImPlot3DColormap> ColormapModifiers;
     ImPlot3DColormapData ColormapData;
+    ImPlot3DFrameArena FrameArena; // Transient allocations of the current frame
+#ifdef IMGUI_HAS_TEXTURES
+    ImVector<ImTextureData*> TexturesToDestroy; // Item textures waiting for the renderer backend to release them
+    ImVector<int> TexturesToDestroyFrame;       // Frame at which each texture was queued for destruction
+    ImVector<ImPlot3DMarkerSprite> MarkerSprites; // Marker sprites rendered into MarkerSpriteAtlas
+    ImFontAtlas* MarkerSpriteAtlas;               // Font atlas holding the marker sprites
+#endif
 };
 
 //-----------------------------------------------------------------------------
@@ -821,6 +1209,12 @@ extern IMPLOT3D_API ImPlot3DContext* GImPlot3D; // Current context pointer
 IMPLOT3D_API void InitializeContext(ImPlot3DContext* ctx); // Initialize ImPlot3DContext
 IMPLOT3D_API void ResetContext(ImPlot3DContext* ctx);      // Reset ImPlot3DContext
 
+// Allocates #size bytes from the frame arena of the current context. The memory is released at the first BeginPlot of the next ImGui frame
+IMPLOT3D_API void* FrameAlloc(size_t size);
+
+// Returns the time elapsed since an arbitrary point in the past (ms), from a monotonic wall clock (e.g. for the progressive time budget)
+IMPLOT3D_API double GetTimeMs();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Style Utils
 //-----------------------------------------------------------------------------
@@ -867,6 +1261,13 @@ IMPLOT3D_API ImPlot3DItem* GetCurrentItem();
 // Busts the cache for every item for every plot in the current context
 IMPLOT3D_API void BustItemCache();
 
+#ifdef IMGUI_HAS_TEXTURES
+// Queues a texture created by an item for destruction. It is released once the renderer backend no longer uses it
+IMPLOT3D_API void DestroyItemTexture(ImTextureData* tex);
+// Releases the queued item textures that the renderer backend has destroyed (called from BeginPlot)
+IMPLOT3D_API void UpdateItemTextures();
+#endif
+
 // TODO move to another place
 IMPLOT3D_API void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, const char* text_begin, const char* text_end = nullptr);
 
@@ -912,6 +1313,22 @@ static inline double TransformForward_SymLog(double v, void*) { return 2.0 * ImA
 
 static inline double TransformInverse_SymLog(double v, void*) { return 2.0 * ImSinh(v / 2.0); }
 
+// Batched forward transforms of the built-in scales. They are branchless and only call sqrt from the math library, so compilers can vectorize them
+IMPLOT3D_API void TransformForwardBatch_Log10(const double* values, double* out, int count, void*);
+IMPLOT3D_API void TransformForwardBatch_SymLog(const double* values, double* out, int count, void*);
+
+// Applies the forward transform of #axis to #count #values, using its batched transform if available (#out may be the same array as #values)
+IMPLOT3D_API void AxisTransformForwardBatch(const ImPlot3DAxis& axis, const double* values, double* out, int count);
+
+// Applies the forward transform of #axis to #v, calling the built-in scales directly instead of through the function pointer
+static inline double AxisTransformForward(const ImPlot3DAxis& axis, double v) {
+    switch (axis.Scale) {
+        case ImPlot3DScale_Log10: return TransformForward_Log10(v, nullptr);
+        case ImPlot3DScale_SymLog: return TransformForward_SymLog(v, nullptr);
+        default: return axis.TransformForward(v, axis.TransformData);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Formatter
 //-----------------------------------------------------------------------------
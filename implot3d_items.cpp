@@ -25,9 +25,13 @@
 // [SECTION] PlotTriangle
 // [SECTION] PlotQuad
 // [SECTION] PlotSurface
+// [SECTION] PlotWaterfall
+// [SECTION] PlotHeatmap3D
 // [SECTION] PlotMesh
+// [SECTION] PlotTube
 // [SECTION] PlotImage
 // [SECTION] PlotText
+// [SECTION] Custom 3D Rendering
 
 //-----------------------------------------------------------------------------
 // [SECTION] Includes
@@ -79,9 +83,13 @@
         }                                                                                                                                            \
     } while (0)
 
-IMPLOT3D_INLINE void GetLineRenderProps(const ImDrawList3D& draw_list_3d, float& half_weight, ImVec2& tex_uv0, ImVec2& tex_uv1) {
+// Computes the half weight of the lines rendered by PrimLine and sets their vertex style. Each line is a quad. With #vtx_cols, the lines are
+// colored per vertex instead of with #col (see PrimLineColors)
+IMPLOT3D_INLINE void SetLineRenderProps(ImDrawList3D& draw_list_3d, float& half_weight, ImU32 col, bool vtx_cols = false) {
+    draw_list_3d.SetPrimFan(4);
     const bool aa = ImPlot3D::ImHasFlag(draw_list_3d._Flags, ImDrawListFlags_AntiAliasedLines) &&
                     ImPlot3D::ImHasFlag(draw_list_3d._Flags, ImDrawListFlags_AntiAliasedLinesUseTex);
+    ImVec2 tex_uv0, tex_uv1;
     if (aa) {
         ImVec4 tex_uvs = draw_list_3d._SharedData->TexUvLines[(int)(half_weight * 2)];
         tex_uv0 = ImVec2(tex_uvs.x, tex_uvs.y);
@@ -90,6 +98,12 @@ IMPLOT3D_INLINE void GetLineRenderProps(const ImDrawList3D& draw_list_3d, float&
     } else {
         tex_uv0 = tex_uv1 = draw_list_3d._SharedData->TexUvWhitePixel;
     }
+    // PrimLine writes the two vertices of one side of the line first, then the two of the other side
+    const ImVec2 uvs[4] = {tex_uv0, tex_uv0, tex_uv1, tex_uv1};
+    if (vtx_cols)
+        draw_list_3d.SetVtxStyle(uvs, 4);
+    else
+        draw_list_3d.SetVtxStyle(col, uvs, 4);
 }
 
 //-----------------------------------------------------------------------------
@@ -137,9 +151,57 @@ namespace ImPlot3D {
 
 static const float ITEM_HIGHLIGHT_LINE_SCALE = 2.0f;
 static const float ITEM_HIGHLIGHT_MARK_SCALE = 1.25f;
+static const float MARKER_LOD_SQUARE_SIZE = 2.0f;  // Markers up to this size (in pixels) are rendered as a filled square
+static const float MARKER_LOD_HEXAGON_SIZE = 4.0f; // Circle markers up to this size (in pixels) are rendered as hexagons
 
 template <typename T> int Stride(const ImPlot3DSpec& spec) { return spec.Stride == IMPLOT3D_AUTO ? sizeof(T) : spec.Stride; }
 
+// Finds the range of the finite values of #values
+template <typename _Indexer> void GetValuesRange(const _Indexer& values, int count, double& min, double& max) {
+    min = HUGE_VAL;
+    max = -HUGE_VAL;
+    for (int i = 0; i < count; i++) {
+        double v = values(i);
+        if (!ImNanOrInf(v)) {
+            min = ImMin(min, v);
+            max = ImMax(max, v);
+        }
+    }
+}
+
+// Colormaps #count values from #min to #max into #cols through the lookup table of the current colormap, multiplying the alpha by #alpha
+template <typename _Indexer> void ColormapValues(ImU32* cols, const _Indexer& values, int count, double min, double max, float alpha) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const ImPlot3DColormap cmap = gp.Style.Colormap;
+    for (int i = 0; i < count; i++) {
+        ImU32 col = gp.ColormapData.LerpTable(cmap, (float)ImClamp(ImRemap01(values(i), min, max), 0.0, 1.0));
+        ImU32 a = (ImU32)(((col >> IM_COL32_A_SHIFT) & 0xFF) * alpha);
+        cols[i] = (col & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+    }
+}
+
+// Returns the colors of #count per-vertex #values, colormapped from #scale_min to #scale_max (or from the minimum to the maximum value if both
+// are 0) with #alpha. The colors are allocated for the current frame (see FrameAlloc)
+template <typename _Indexer> const ImU32* ColormapVertices(const _Indexer& values, int count, double scale_min, double scale_max, float alpha) {
+    double min = scale_min;
+    double max = scale_max;
+    if (scale_min == 0.0 && scale_max == 0.0)
+        GetValuesRange(values, count, min, max);
+    ImU32* cols = (ImU32*)FrameAlloc(sizeof(ImU32) * count);
+    ColormapValues(cols, values, count, min, max, alpha);
+    return cols;
+}
+
+// Returns how the primitives of the current item are depth sorted (ImDrawList3DSortMode_)
+static int GetItemSortMode() {
+    const ImPlot3DItemFlags flags = GetItemData().Spec.Flags;
+    if (ImHasFlag(flags, ImPlot3DItemFlags_NoDepthSort))
+        return ImDrawList3DSortMode_Unsorted;
+    if (ImHasFlag(flags, ImPlot3DItemFlags_PreSorted))
+        return ImDrawList3DSortMode_PreSorted;
+    return ImDrawList3DSortMode_Sorted;
+}
+
 bool BeginItem(const char* label_id, const ImPlot3DSpec& spec, const ImVec4& item_col, ImPlot3DMarker item_mkr) {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
@@ -216,6 +278,9 @@ bool BeginItem(const char* label_id, const ImPlot3DSpec& spec, const ImVec4& ite
         }
     }
 
+    // Primitives added by the item are depth sorted according to its flags
+    gp.CurrentPlot->DrawList.SetSortMode(GetItemSortMode());
+
     return true;
 }
 
@@ -224,9 +289,43 @@ template <typename _Getter> bool BeginItemEx(const char* label_id, const _Getter
     if (BeginItem(label_id, spec, item_col, item_mkr)) {
         ImPlot3DContext& gp = *GImPlot3D;
         ImPlot3DPlot& plot = *gp.CurrentPlot;
-        if (plot.FitThisFrame && !ImHasFlag(spec.Flags, ImPlot3DItemFlags_NoFit)) {
-            for (int i = 0; i < getter.Count; i++)
-                plot.ExtendFit(getter(i));
+        ImPlot3DItem& item = *gp.CurrentItem;
+        ImPlot3DNextItemData& n = gp.NextItemData;
+        const bool fit = plot.FitThisFrame && !ImHasFlag(spec.Flags, ImPlot3DItemFlags_NoFit);
+
+        // Bounds of the data, to accept or reject all primitives at once when rendering (see GetItemCull). They are provided by the caller,
+        // cached per data version, or computed along with the fit pass. Data with NaN values has no bounds, its primitives are always culled
+        bool compute_bounds = false;
+        if (spec.Bounds != nullptr) {
+            n.Bounds = *spec.Bounds;
+            n.HasBounds = true;
+        } else if (spec.DataVersion >= 0 && item.BoundsVersion == spec.DataVersion && item.BoundsCount == getter.Count) {
+            n.Bounds = item.Bounds;
+            n.HasBounds = item.BoundsValid;
+        } else {
+            compute_bounds = fit || spec.DataVersion >= 0;
+        }
+
+        if (fit || compute_bounds) {
+            ImPlot3DBox bounds(ImPlot3DPoint(HUGE_VAL, HUGE_VAL, HUGE_VAL), ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL));
+            bool has_nan = false;
+            for (int i = 0; i < getter.Count; i++) {
+                const ImPlot3DPoint p = getter(i);
+                if (fit)
+                    plot.ExtendFit(p);
+                if (compute_bounds) {
+                    bounds.Expand(p);
+                    has_nan |= p.IsNaN();
+                }
+            }
+            if (compute_bounds) {
+                n.Bounds = bounds;
+                n.HasBounds = !has_nan;
+                item.Bounds = bounds;
+                item.BoundsValid = !has_nan;
+                item.BoundsVersion = spec.DataVersion;
+                item.BoundsCount = getter.Count;
+            }
         }
         return true;
     }
@@ -235,6 +334,10 @@ template <typename _Getter> bool BeginItemEx(const char* label_id, const _Getter
 
 void EndItem() {
     ImPlot3DContext& gp = *GImPlot3D;
+    if (gp.CurrentPlot != nullptr) {
+        gp.CurrentPlot->PreScaled = false;
+        gp.CurrentPlot->DrawList.SetSortMode(ImDrawList3DSortMode_Sorted);
+    }
     gp.NextItemData.Reset();
     gp.CurrentItem = nullptr;
 }
@@ -276,45 +379,90 @@ void BustItemCache() {
     }
 }
 
+#ifdef IMGUI_HAS_TEXTURES
+void DestroyItemTexture(ImTextureData* tex) {
+    if (tex == nullptr)
+        return;
+    tex->WantDestroyNextFrame = true;
+    if (GImPlot3D == nullptr) {
+        // No context to defer to (e.g. the context is being destroyed), release it right away
+        if (GImGui != nullptr)
+            ImGui::UnregisterUserTexture(tex);
+        IM_DELETE(tex);
+        return;
+    }
+    ImPlot3DContext& gp = *GImPlot3D;
+    gp.TexturesToDestroy.push_back(tex);
+    gp.TexturesToDestroyFrame.push_back(ImGui::GetFrameCount());
+}
+
+void UpdateItemTextures() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    for (int i = 0; i < gp.TexturesToDestroy.Size; i++) {
+        // Draw commands submitted in the frame the texture was queued may still use it
+        if (gp.TexturesToDestroyFrame[i] >= frame)
+            continue;
+        ImTextureData* tex = gp.TexturesToDestroy[i];
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_Destroyed) {
+            // Never uploaded or already released by the backend
+            ImGui::UnregisterUserTexture(tex);
+            IM_DELETE(tex);
+            gp.TexturesToDestroy.erase(gp.TexturesToDestroy.Data + i);
+            gp.TexturesToDestroyFrame.erase(gp.TexturesToDestroyFrame.Data + i);
+            i--;
+        } else if (tex->Status != ImTextureStatus_WantDestroy) {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+        }
+    }
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Draw Utils
 //-----------------------------------------------------------------------------
 
-IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col, const ImVec2& tex_uv0,
-                              const ImVec2& tex_uv1, double z) {
+IMPLOT3D_INLINE void PrimLine(ImDrawList3D& draw_list_3d, const ImVec2& P1, const ImVec2& P2, float half_weight, double z) {
     float dx = P2.x - P1.x;
     float dy = P2.y - P1.y;
     IMPLOT3D_NORMALIZE2F(dx, dy);
     dx *= half_weight;
     dy *= half_weight;
-    draw_list_3d._VtxWritePtr[0].pos.x = P1.x + dy;
-    draw_list_3d._VtxWritePtr[0].pos.y = P1.y - dx;
-    draw_list_3d._VtxWritePtr[0].uv = tex_uv0;
-    draw_list_3d._VtxWritePtr[0].col = col;
-    draw_list_3d._VtxWritePtr[1].pos.x = P2.x + dy;
-    draw_list_3d._VtxWritePtr[1].pos.y = P2.y - dx;
-    draw_list_3d._VtxWritePtr[1].uv = tex_uv0;
-    draw_list_3d._VtxWritePtr[1].col = col;
-    draw_list_3d._VtxWritePtr[2].pos.x = P2.x - dy;
-    draw_list_3d._VtxWritePtr[2].pos.y = P2.y + dx;
-    draw_list_3d._VtxWritePtr[2].uv = tex_uv1;
-    draw_list_3d._VtxWritePtr[2].col = col;
-    draw_list_3d._VtxWritePtr[3].pos.x = P1.x - dy;
-    draw_list_3d._VtxWritePtr[3].pos.y = P1.y + dx;
-    draw_list_3d._VtxWritePtr[3].uv = tex_uv1;
-    draw_list_3d._VtxWritePtr[3].col = col;
-    draw_list_3d._VtxWritePtr += 4;
-    draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-    draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
-    draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-    draw_list_3d._IdxWritePtr[3] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-    draw_list_3d._IdxWritePtr[4] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-    draw_list_3d._IdxWritePtr[5] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 3);
-    draw_list_3d._IdxWritePtr += 6;
+    draw_list_3d._PosWritePtr[0].x = P1.x + dy;
+    draw_list_3d._PosWritePtr[0].y = P1.y - dx;
+    draw_list_3d._PosWritePtr[1].x = P2.x + dy;
+    draw_list_3d._PosWritePtr[1].y = P2.y - dx;
+    draw_list_3d._PosWritePtr[2].x = P2.x - dy;
+    draw_list_3d._PosWritePtr[2].y = P2.y + dx;
+    draw_list_3d._PosWritePtr[3].x = P1.x - dy;
+    draw_list_3d._PosWritePtr[3].y = P1.y + dx;
+    draw_list_3d._PosWritePtr += 4;
     draw_list_3d._VtxCurrentIdx += 4;
     draw_list_3d._ZWritePtr[0] = z;
-    draw_list_3d._ZWritePtr[1] = z;
-    draw_list_3d._ZWritePtr += 2;
+    draw_list_3d._ZWritePtr++;
+}
+
+// Writes the vertex colors of a line added by PrimLine, going from #col1 at #P1_plot to #col2 at #P2_plot. The line may have been clipped to
+// #P1_clipped and #P2_clipped, so the colors are interpolated at the clipped endpoints
+IMPLOT3D_INLINE void PrimLineColors(ImDrawList3D& draw_list_3d, const ImPlot3DPoint& P1_plot, const ImPlot3DPoint& P2_plot,
+                                    const ImPlot3DPoint& P1_clipped, const ImPlot3DPoint& P2_clipped, ImU32 col1, ImU32 col2) {
+    if (col1 != col2 && (P1_clipped != P1_plot || P2_clipped != P2_plot)) {
+        const ImPlot3DPoint dir = P2_plot - P1_plot;
+        const double len_sqr = dir.Dot(dir);
+        if (len_sqr > 0.0) {
+            const double t1 = ImClamp((P1_clipped - P1_plot).Dot(dir) / len_sqr, 0.0, 1.0);
+            const double t2 = ImClamp((P2_clipped - P1_plot).Dot(dir) / len_sqr, 0.0, 1.0);
+            const ImU32 col = col1;
+            col1 = ImMixU32(col, col2, (ImU32)(t1 * 256));
+            col2 = ImMixU32(col, col2, (ImU32)(t2 * 256));
+        }
+    }
+    // PrimLine writes the vertices at P1, P2, P2 and P1
+    draw_list_3d._ColWritePtr[0] = col1;
+    draw_list_3d._ColWritePtr[1] = col2;
+    draw_list_3d._ColWritePtr[2] = col2;
+    draw_list_3d._ColWritePtr[3] = col1;
+    draw_list_3d._ColWritePtr += 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -325,6 +473,13 @@ double GetPointDepth(ImPlot3DPoint p) {
     ImPlot3DContext& gp = *GImPlot3D;
     ImPlot3DPlot& plot = *gp.CurrentPlot;
 
+    // Compute depth in scaled space (e.g. log10 of the values on log axes), consistently with pre-scaled points
+    if (!plot.PreScaled) {
+        for (int i = 0; i < 3; i++)
+            if (plot.Axes[i].TransformForward != nullptr)
+                p[i] = AxisTransformForward(plot.Axes[i], p[i]);
+    }
+
     // Adjust for inverted axes before rotation
     if (ImHasFlag(plot.Axes[0].Flags, ImPlot3DAxisFlags_Invert))
         p.x = -p.x;
@@ -337,43 +492,128 @@ double GetPointDepth(ImPlot3DPoint p) {
     return p_rot.z;
 }
 
+// Maps model space points to pixels and depths, applying a model transform (scale, then rotation, then translation) before the plot projection.
+// When no axis has a scale transform, both are affine and are fused into a single matrix, so each point costs one 3x4 product. Otherwise the
+// points are transformed to plot space and projected with PlotToPixels and GetPointDepth
+struct ModelProjection {
+    ModelProjection(const ImPlot3DPlot& plot) : Translation(0.0, 0.0, 0.0), Scale(1.0, 1.0, 1.0) {
+        Linear = true;
+        for (int i = 0; i < 3; i++)
+            Linear &= plot.Axes[i].TransformForward == nullptr;
+        if (!Linear)
+            return;
+
+        // Plot to NDC scales and offsets each axis (see PlotToNDC)
+        ImPlot3DPoint ndc_scale, ndc_offset;
+        for (int i = 0; i < 3; i++) {
+            const ImPlot3DAxis& axis = plot.Axes[i];
+            const double sign = ImHasFlag(axis.Flags, ImPlot3DAxisFlags_Invert) ? -1.0 : 1.0;
+            ndc_scale[i] = sign * axis.NDCScale / (axis.Range.Max - axis.Range.Min);
+            ndc_offset[i] = sign * (-axis.Range.Min / (axis.Range.Max - axis.Range.Min) - 0.5) * axis.NDCScale;
+        }
+
+        // NDC to pixels rotates and scales the point, flips y and moves it to the plot center (see NDCToPixels). The depth is the rotated z of
+        // the point with the inverted axes negated (see GetPointDepth)
+        const double view_scale = plot.GetViewScale();
+        const ImVec2 center = plot.PlotRect.GetCenter();
+        for (int i = 0; i < 3; i++) {
+            ImPlot3DPoint axis_dir(0.0, 0.0, 0.0);
+            axis_dir[i] = 1.0;
+            const ImPlot3DPoint rot_dir = plot.Rotation * axis_dir;
+            PlotMatrix[0][i] = view_scale * rot_dir.x * ndc_scale[i];
+            PlotMatrix[1][i] = -view_scale * rot_dir.y * ndc_scale[i];
+            PlotMatrix[2][i] = ImHasFlag(plot.Axes[i].Flags, ImPlot3DAxisFlags_Invert) ? -rot_dir.z : rot_dir.z;
+        }
+        const ImPlot3DPoint rot_offset = plot.Rotation * ndc_offset;
+        PlotMatrix[0][3] = view_scale * rot_offset.x + center.x;
+        PlotMatrix[1][3] = -view_scale * rot_offset.y + center.y;
+        PlotMatrix[2][3] = 0.0;
+        memcpy(Matrix, PlotMatrix, sizeof(Matrix));
+    }
+
+    // Sets the model transform of the next points
+    void SetModel(const ImPlot3DPoint& translation, const ImPlot3DQuat& rotation, const ImPlot3DPoint& scale) {
+        Translation = translation;
+        Rotation = rotation;
+        Scale = scale;
+        if (!Linear)
+            return;
+        for (int i = 0; i < 3; i++) {
+            ImPlot3DPoint axis_dir(0.0, 0.0, 0.0);
+            axis_dir[i] = scale[i];
+            const ImPlot3DPoint model_dir = rotation * axis_dir;
+            for (int r = 0; r < 3; r++)
+                Matrix[r][i] = PlotMatrix[r][0] * model_dir.x + PlotMatrix[r][1] * model_dir.y + PlotMatrix[r][2] * model_dir.z;
+        }
+        for (int r = 0; r < 3; r++)
+            Matrix[r][3] = PlotMatrix[r][0] * translation.x + PlotMatrix[r][1] * translation.y + PlotMatrix[r][2] * translation.z + PlotMatrix[r][3];
+    }
+
+    IMPLOT3D_INLINE ImPlot3DPoint ToPlot(const ImPlot3DPoint& p) const { return Translation + Rotation * (p * Scale); }
+
+    // Maps #count model points of #in to plot coordinates in #out, rotating them as a batch (see ImPlot3DQuat::Rotate)
+    void ToPlot(const ImPlot3DPoint* in, ImPlot3DPoint* out, int count) const {
+        for (int i = 0; i < count; i++)
+            out[i] = in[i] * Scale;
+        Rotation.Rotate(out, out, count);
+        for (int i = 0; i < count; i++)
+            out[i] += Translation;
+    }
+
+    IMPLOT3D_INLINE ImVec2 ToPixels(const ImPlot3DPoint& p) const {
+        if (!Linear)
+            return PlotToPixels(ToPlot(p));
+        return ImVec2((float)(Matrix[0][0] * p.x + Matrix[0][1] * p.y + Matrix[0][2] * p.z + Matrix[0][3]),
+                      (float)(Matrix[1][0] * p.x + Matrix[1][1] * p.y + Matrix[1][2] * p.z + Matrix[1][3]));
+    }
+
+    IMPLOT3D_INLINE double ToDepth(const ImPlot3DPoint& p) const {
+        if (!Linear)
+            return GetPointDepth(ToPlot(p));
+        return Matrix[2][0] * p.x + Matrix[2][1] * p.y + Matrix[2][2] * p.z + Matrix[2][3];
+    }
+
+    bool Linear;               // No axis has a scale transform, Matrix maps model points to pixels (rows 0 and 1) and depth (row 2)
+    double PlotMatrix[3][4];   // Plot to pixels and depth
+    double Matrix[3][4];       // Model to pixels and depth, PlotMatrix combined with the model transform
+    ImPlot3DPoint Translation; // Model transform
+    ImPlot3DQuat Rotation;
+    ImPlot3DPoint Scale;
+};
+
 struct RendererBase {
     RendererBase(int prims, int idx_consumed, int vtx_consumed) : Prims(prims), IdxConsumed(idx_consumed), VtxConsumed(vtx_consumed) {}
     const unsigned int Prims;       // Number of primitives to render
     const unsigned int IdxConsumed; // Number of indices consumed per primitive
     const unsigned int VtxConsumed; // Number of vertices consumed per primitive
+
+    // Prepares the renderer to render #prim out of order (progressive refinement). Renderers carrying state between primitives override it
+    void Seek(int prim) const { IM_UNUSED(prim); }
 };
 
 template <class _Getter> struct RendererMarkersFill : RendererBase {
     RendererMarkersFill(const _Getter& getter, const ImVec2* marker, int count, float size, ImU32 col)
         : RendererBase(getter.Count, (count - 2) * 3, count), Getter(getter), Marker(marker), Count(count), Size(size), Col(col) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const { UV = draw_list_3d._SharedData->TexUvWhitePixel; }
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(Count);
+        draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint p_plot = Getter(prim);
         if (!cull_box.Contains(p_plot))
             return false;
         ImVec2 p = PlotToPixels(p_plot);
         // 3 vertices per triangle
         for (int i = 0; i < Count; i++) {
-            draw_list_3d._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
-            draw_list_3d._VtxWritePtr[0].pos.y = p.y + Marker[i].y * Size;
-            draw_list_3d._VtxWritePtr[0].uv = UV;
-            draw_list_3d._VtxWritePtr[0].col = Col;
-            draw_list_3d._VtxWritePtr++;
-        }
-        // 3 indices per triangle
-        for (int i = 2; i < Count; i++) {
-            // Indices
-            draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-            draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + i - 1);
-            draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + i);
-            draw_list_3d._IdxWritePtr += 3;
-            // Z
-            draw_list_3d._ZWritePtr[0] = GetPointDepth(p_plot);
-            draw_list_3d._ZWritePtr++;
+            draw_list_3d._PosWritePtr[0].x = p.x + Marker[i].x * Size;
+            draw_list_3d._PosWritePtr[0].y = p.y + Marker[i].y * Size;
+            draw_list_3d._PosWritePtr++;
         }
+        // 1 Z per marker
+        draw_list_3d._ZWritePtr[0] = GetPointDepth(p_plot);
+        draw_list_3d._ZWritePtr++;
         // Update vertex count
         draw_list_3d._VtxCurrentIdx += (ImDrawIdx)Count;
         return true;
@@ -383,7 +623,6 @@ template <class _Getter> struct RendererMarkersFill : RendererBase {
     const int Count;
     const float Size;
     const ImU32 Col;
-    mutable ImVec2 UV;
 };
 
 template <class _Getter> struct RendererMarkersLine : RendererBase {
@@ -391,9 +630,9 @@ template <class _Getter> struct RendererMarkersLine : RendererBase {
         : RendererBase(getter.Count, count / 2 * 6, count / 2 * 4), Getter(getter), Marker(marker), Count(count),
           HalfWeight(ImMax(1.0f, weight) * 0.5f), Size(size), Col(col) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
+    void Init(ImDrawList3D& draw_list_3d) const { SetLineRenderProps(draw_list_3d, HalfWeight, Col); }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint p_plot = Getter(prim);
         if (!cull_box.Contains(p_plot))
             return false;
@@ -401,7 +640,7 @@ template <class _Getter> struct RendererMarkersLine : RendererBase {
         for (int i = 0; i < Count; i = i + 2) {
             ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
             ImVec2 p2(p.x + Marker[i + 1].x * Size, p.y + Marker[i + 1].y * Size);
-            PrimLine(draw_list_3d, p1, p2, HalfWeight, Col, UV0, UV1, GetPointDepth(p_plot));
+            PrimLine(draw_list_3d, p1, p2, HalfWeight, GetPointDepth(p_plot));
         }
         return true;
     }
@@ -412,20 +651,60 @@ template <class _Getter> struct RendererMarkersLine : RendererBase {
     mutable float HalfWeight;
     const float Size;
     const ImU32 Col;
-    mutable ImVec2 UV0;
-    mutable ImVec2 UV1;
+};
+
+template <class _Getter> struct RendererMarkersSprite : RendererBase {
+    RendererMarkersSprite(const _Getter& getter, const ImVec2& uv0, const ImVec2& uv1, float half_extent, ImU32 col)
+        : RendererBase(getter.Count, 6, 4), Getter(getter), UV0(uv0), UV1(uv1), HalfExtent(half_extent), Col(col) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(4);
+        const ImVec2 uvs[4] = {UV0, ImVec2(UV1.x, UV0.y), UV1, ImVec2(UV0.x, UV1.y)};
+        draw_list_3d.SetVtxStyle(Col, uvs, 4);
+    }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        ImPlot3DPoint p_plot = Getter(prim);
+        if (!cull_box.Contains(p_plot))
+            return false;
+        ImVec2 p = PlotToPixels(p_plot);
+        // One textured quad per marker
+        draw_list_3d._PosWritePtr[0] = ImVec2(p.x - HalfExtent, p.y - HalfExtent);
+        draw_list_3d._PosWritePtr[1] = ImVec2(p.x + HalfExtent, p.y - HalfExtent);
+        draw_list_3d._PosWritePtr[2] = ImVec2(p.x + HalfExtent, p.y + HalfExtent);
+        draw_list_3d._PosWritePtr[3] = ImVec2(p.x - HalfExtent, p.y + HalfExtent);
+        draw_list_3d._PosWritePtr += 4;
+
+        // Add depth value for the sprite
+        double z = GetPointDepth(p_plot);
+        draw_list_3d._ZWritePtr[0] = z;
+        draw_list_3d._ZWritePtr++;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 4;
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImVec2 UV0;
+    const ImVec2 UV1;
+    const float HalfExtent;
+    const ImU32 Col;
 };
 
 template <class _Getter> struct RendererLineStrip : RendererBase {
-    RendererLineStrip(const _Getter& getter, ImU32 col, float weight)
-        : RendererBase(getter.Count - 1, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {
+    // With #vtx_cols, the color of each segment goes from the color of its first point to the one of its second point (see VertexIndex)
+    RendererLineStrip(const _Getter& getter, ImU32 col, float weight, const ImU32* vtx_cols = nullptr)
+        : RendererBase(getter.Count - 1, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f), VtxCols(vtx_cols) {
         // Initialize the first point in plot coordinates
         P1_plot = Getter(0);
     }
 
-    void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
+    void Init(ImDrawList3D& draw_list_3d) const { SetLineRenderProps(draw_list_3d, HalfWeight, Col, VtxCols != nullptr); }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    void Seek(int prim) const { P1_plot = Getter(prim); }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint P2_plot = Getter(prim + 1);
 
         // Clip the line segment to the culling box using Liang-Barsky algorithm
@@ -437,7 +716,10 @@ template <class _Getter> struct RendererLineStrip : RendererBase {
             ImVec2 P1_screen = PlotToPixels(P1_clipped);
             ImVec2 P2_screen = PlotToPixels(P2_clipped);
             // Render the line segment
-            PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5));
+            PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointDepth((P1_plot + P2_plot) * 0.5));
+            if (VtxCols != nullptr)
+                PrimLineColors(draw_list_3d, P1_plot, P2_plot, P1_clipped, P2_clipped, VtxCols[Getter.VertexIndex(prim)],
+                               VtxCols[Getter.VertexIndex(prim + 1)]);
         }
 
         // Update for next segment
@@ -449,21 +731,33 @@ template <class _Getter> struct RendererLineStrip : RendererBase {
     const _Getter& Getter;
     const ImU32 Col;
     mutable float HalfWeight;
+    const ImU32* VtxCols;
     mutable ImPlot3DPoint P1_plot;
-    mutable ImVec2 UV0;
-    mutable ImVec2 UV1;
 };
 
 template <class _Getter> struct RendererLineStripSkip : RendererBase {
-    RendererLineStripSkip(const _Getter& getter, ImU32 col, float weight)
-        : RendererBase(getter.Count - 1, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {
+    // With #vtx_cols, the color of each segment goes from the color of its first point to the one of its second point (see VertexIndex)
+    RendererLineStripSkip(const _Getter& getter, ImU32 col, float weight, const ImU32* vtx_cols = nullptr)
+        : RendererBase(getter.Count - 1, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f), VtxCols(vtx_cols) {
         // Initialize the first point in plot coordinates
         P1_plot = Getter(0);
+        P1_idx = 0;
+        NextPrim = 0;
     }
 
-    void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
+    void Init(ImDrawList3D& draw_list_3d) const { SetLineRenderProps(draw_list_3d, HalfWeight, Col, VtxCols != nullptr); }
+
+    void Seek(int prim) const {
+        // Consecutive primitives carry the last valid point, which may be before a run of NaNs
+        if (prim == NextPrim)
+            return;
+        P1_idx = prim;
+        P1_plot = Getter(prim);
+        while (P1_idx > 0 && P1_plot.IsNaN())
+            P1_plot = Getter(--P1_idx);
+    }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         // Get the next point in plot coordinates
         ImPlot3DPoint P2_plot = Getter(prim + 1);
         bool visible = false;
@@ -480,13 +774,19 @@ template <class _Getter> struct RendererLineStripSkip : RendererBase {
                 ImVec2 P1_screen = PlotToPixels(P1_clipped);
                 ImVec2 P2_screen = PlotToPixels(P2_clipped);
                 // Render the line segment
-                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5));
+                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointDepth((P1_plot + P2_plot) * 0.5));
+                if (VtxCols != nullptr)
+                    PrimLineColors(draw_list_3d, P1_plot, P2_plot, P1_clipped, P2_clipped, VtxCols[Getter.VertexIndex(P1_idx)],
+                                   VtxCols[Getter.VertexIndex(prim + 1)]);
             }
         }
 
         // Update P1_plot if P2_plot is valid
-        if (!ImNan(P2_plot.x) && !ImNan(P2_plot.y) && !ImNan(P2_plot.z))
+        if (!ImNan(P2_plot.x) && !ImNan(P2_plot.y) && !ImNan(P2_plot.z)) {
             P1_plot = P2_plot;
+            P1_idx = prim + 1;
+        }
+        NextPrim = prim + 1;
 
         return visible;
     }
@@ -494,18 +794,20 @@ template <class _Getter> struct RendererLineStripSkip : RendererBase {
     const _Getter& Getter;
     const ImU32 Col;
     mutable float HalfWeight;
+    const ImU32* VtxCols;
     mutable ImPlot3DPoint P1_plot;
-    mutable ImVec2 UV0;
-    mutable ImVec2 UV1;
+    mutable int P1_idx;   // Index of P1_plot
+    mutable int NextPrim; // Primitive following the last rendered one, which starts at P1_plot without seeking
 };
 
 template <class _Getter> struct RendererLineSegments : RendererBase {
-    RendererLineSegments(const _Getter& getter, ImU32 col, float weight)
-        : RendererBase(getter.Count / 2, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {}
+    // With #vtx_cols, the color of each segment goes from the color of its first point to the one of its second point (see VertexIndex)
+    RendererLineSegments(const _Getter& getter, ImU32 col, float weight, const ImU32* vtx_cols = nullptr)
+        : RendererBase(getter.Count / 2, 6, 4), Getter(getter), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f), VtxCols(vtx_cols) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const { GetLineRenderProps(draw_list_3d, HalfWeight, UV0, UV1); }
+    void Init(ImDrawList3D& draw_list_3d) const { SetLineRenderProps(draw_list_3d, HalfWeight, Col, VtxCols != nullptr); }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         // Get the segment's endpoints in plot coordinates
         ImPlot3DPoint P1_plot = Getter(prim * 2 + 0);
         ImPlot3DPoint P2_plot = Getter(prim * 2 + 1);
@@ -522,7 +824,10 @@ template <class _Getter> struct RendererLineSegments : RendererBase {
                 ImVec2 P1_screen = PlotToPixels(P1_clipped);
                 ImVec2 P2_screen = PlotToPixels(P2_clipped);
                 // Render the line segment
-                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, Col, UV0, UV1, GetPointDepth((P1_plot + P2_plot) * 0.5));
+                PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, GetPointDepth((P1_plot + P2_plot) * 0.5));
+                if (VtxCols != nullptr)
+                    PrimLineColors(draw_list_3d, P1_plot, P2_plot, P1_clipped, P2_clipped, VtxCols[Getter.VertexIndex(prim * 2 + 0)],
+                                   VtxCols[Getter.VertexIndex(prim * 2 + 1)]);
             }
             return visible;
         }
@@ -533,16 +838,24 @@ template <class _Getter> struct RendererLineSegments : RendererBase {
     const _Getter& Getter;
     const ImU32 Col;
     mutable float HalfWeight;
-    mutable ImVec2 UV0;
-    mutable ImVec2 UV1;
+    const ImU32* VtxCols;
 };
 
 template <class _Getter> struct RendererTriangleFill : RendererBase {
-    RendererTriangleFill(const _Getter& getter, ImU32 col) : RendererBase(getter.Count / 3, 3, 3), Getter(getter), Col(col) {}
+    // With #vtx_cols, each vertex takes the color of the data point it was read from (see VertexIndex). With #face_cols, each triangle takes the
+    // color of its index. Otherwise the triangles are filled with #col
+    RendererTriangleFill(const _Getter& getter, ImU32 col, const ImU32* vtx_cols = nullptr, const ImU32* face_cols = nullptr)
+        : RendererBase(getter.Count / 3, 3, 3), Getter(getter), Col(col), VtxCols(vtx_cols), FaceCols(face_cols) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const { UV = draw_list_3d._SharedData->TexUvWhitePixel; }
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(3);
+        if (VtxCols != nullptr || FaceCols != nullptr)
+            draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        else
+            draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint p_plot[3];
         p_plot[0] = Getter(3 * prim);
         p_plot[1] = Getter(3 * prim + 1);
@@ -552,6 +865,16 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
         if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]))
             return false;
 
+        if (VtxCols != nullptr) {
+            draw_list_3d._ColWritePtr[0] = VtxCols[Getter.VertexIndex(3 * prim)];
+            draw_list_3d._ColWritePtr[1] = VtxCols[Getter.VertexIndex(3 * prim + 1)];
+            draw_list_3d._ColWritePtr[2] = VtxCols[Getter.VertexIndex(3 * prim + 2)];
+            draw_list_3d._ColWritePtr += 3;
+        } else if (FaceCols != nullptr) {
+            draw_list_3d._ColWritePtr[0] = draw_list_3d._ColWritePtr[1] = draw_list_3d._ColWritePtr[2] = FaceCols[prim];
+            draw_list_3d._ColWritePtr += 3;
+        }
+
         // Project the triangle vertices to screen space
         ImVec2 p[3];
         p[0] = PlotToPixels(p_plot[0]);
@@ -559,26 +882,15 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
         p[2] = PlotToPixels(p_plot[2]);
 
         // 3 vertices per triangle
-        draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
-        draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
-        draw_list_3d._VtxWritePtr[0].uv = UV;
-        draw_list_3d._VtxWritePtr[0].col = Col;
-        draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
-        draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
-        draw_list_3d._VtxWritePtr[1].uv = UV;
-        draw_list_3d._VtxWritePtr[1].col = Col;
-        draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
-        draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
-        draw_list_3d._VtxWritePtr[2].uv = UV;
-        draw_list_3d._VtxWritePtr[2].col = Col;
-        draw_list_3d._VtxWritePtr += 3;
-
-        // 3 indices per triangle
-        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
-        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-        draw_list_3d._IdxWritePtr += 3;
-        // 1 Z per vertex
+        draw_list_3d._PosWritePtr[0].x = p[0].x;
+        draw_list_3d._PosWritePtr[0].y = p[0].y;
+        draw_list_3d._PosWritePtr[1].x = p[1].x;
+        draw_list_3d._PosWritePtr[1].y = p[1].y;
+        draw_list_3d._PosWritePtr[2].x = p[2].x;
+        draw_list_3d._PosWritePtr[2].y = p[2].y;
+        draw_list_3d._PosWritePtr += 3;
+
+        // 1 Z per triangle
         draw_list_3d._ZWritePtr[0] = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2]) / 3);
         draw_list_3d._ZWritePtr++;
 
@@ -589,16 +901,20 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
     }
 
     const _Getter& Getter;
-    mutable ImVec2 UV;
     const ImU32 Col;
+    const ImU32* VtxCols;
+    const ImU32* FaceCols;
 };
 
 template <class _Getter> struct RendererQuadFill : RendererBase {
     RendererQuadFill(const _Getter& getter, ImU32 col) : RendererBase(getter.Count / 4, 6, 4), Getter(getter), Col(col) {}
 
-    void Init(ImDrawList3D& draw_list_3d) const { UV = draw_list_3d._SharedData->TexUvWhitePixel; }
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(4);
+        draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint p_plot[4];
         p_plot[0] = Getter(4 * prim);
         p_plot[1] = Getter(4 * prim + 1);
@@ -617,44 +933,24 @@ template <class _Getter> struct RendererQuadFill : RendererBase {
         p[3] = PlotToPixels(p_plot[3]);
 
         // Add vertices for two triangles
-        draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
-        draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
-        draw_list_3d._VtxWritePtr[0].uv = UV;
-        draw_list_3d._VtxWritePtr[0].col = Col;
+        draw_list_3d._PosWritePtr[0].x = p[0].x;
+        draw_list_3d._PosWritePtr[0].y = p[0].y;
 
-        draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
-        draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
-        draw_list_3d._VtxWritePtr[1].uv = UV;
-        draw_list_3d._VtxWritePtr[1].col = Col;
+        draw_list_3d._PosWritePtr[1].x = p[1].x;
+        draw_list_3d._PosWritePtr[1].y = p[1].y;
 
-        draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
-        draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
-        draw_list_3d._VtxWritePtr[2].uv = UV;
-        draw_list_3d._VtxWritePtr[2].col = Col;
+        draw_list_3d._PosWritePtr[2].x = p[2].x;
+        draw_list_3d._PosWritePtr[2].y = p[2].y;
 
-        draw_list_3d._VtxWritePtr[3].pos.x = p[3].x;
-        draw_list_3d._VtxWritePtr[3].pos.y = p[3].y;
-        draw_list_3d._VtxWritePtr[3].uv = UV;
-        draw_list_3d._VtxWritePtr[3].col = Col;
+        draw_list_3d._PosWritePtr[3].x = p[3].x;
+        draw_list_3d._PosWritePtr[3].y = p[3].y;
 
-        draw_list_3d._VtxWritePtr += 4;
-
-        // Add indices for two triangles
-        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
-        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-
-        draw_list_3d._IdxWritePtr[3] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[4] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-        draw_list_3d._IdxWritePtr[5] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 3);
-
-        draw_list_3d._IdxWritePtr += 6;
+        draw_list_3d._PosWritePtr += 4;
 
         // Add depth value for the quad
         double z = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0);
         draw_list_3d._ZWritePtr[0] = z;
-        draw_list_3d._ZWritePtr[1] = z;
-        draw_list_3d._ZWritePtr += 2;
+        draw_list_3d._ZWritePtr++;
 
         // Update vertex count
         draw_list_3d._VtxCurrentIdx += 4;
@@ -663,7 +959,6 @@ template <class _Getter> struct RendererQuadFill : RendererBase {
     }
 
     const _Getter& Getter;
-    mutable ImVec2 UV;
     const ImU32 Col;
 };
 
@@ -672,9 +967,13 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
                       ImU32 col)
         : RendererBase(getter.Count / 4, 6, 4), Getter(getter), TexRef(tex_ref), UV0(uv0), UV1(uv1), UV2(uv2), UV3(uv3), Col(col) {}
 
-    void Init(ImDrawList3D& /*draw_list_3d*/) const {}
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(4);
+        const ImVec2 uvs[4] = {UV0, UV1, UV2, UV3};
+        draw_list_3d.SetVtxStyle(Col, uvs, 4);
+    }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         ImPlot3DPoint p_plot[4];
         p_plot[0] = Getter(4 * prim);
         p_plot[1] = Getter(4 * prim + 1);
@@ -696,44 +995,24 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
         p[3] = PlotToPixels(p_plot[3]);
 
         // Add vertices for two triangles
-        draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
-        draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
-        draw_list_3d._VtxWritePtr[0].uv = UV0;
-        draw_list_3d._VtxWritePtr[0].col = Col;
-
-        draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
-        draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
-        draw_list_3d._VtxWritePtr[1].uv = UV1;
-        draw_list_3d._VtxWritePtr[1].col = Col;
+        draw_list_3d._PosWritePtr[0].x = p[0].x;
+        draw_list_3d._PosWritePtr[0].y = p[0].y;
 
-        draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
-        draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
-        draw_list_3d._VtxWritePtr[2].uv = UV2;
-        draw_list_3d._VtxWritePtr[2].col = Col;
+        draw_list_3d._PosWritePtr[1].x = p[1].x;
+        draw_list_3d._PosWritePtr[1].y = p[1].y;
 
-        draw_list_3d._VtxWritePtr[3].pos.x = p[3].x;
-        draw_list_3d._VtxWritePtr[3].pos.y = p[3].y;
-        draw_list_3d._VtxWritePtr[3].uv = UV3;
-        draw_list_3d._VtxWritePtr[3].col = Col;
+        draw_list_3d._PosWritePtr[2].x = p[2].x;
+        draw_list_3d._PosWritePtr[2].y = p[2].y;
 
-        draw_list_3d._VtxWritePtr += 4;
+        draw_list_3d._PosWritePtr[3].x = p[3].x;
+        draw_list_3d._PosWritePtr[3].y = p[3].y;
 
-        // Add indices for two triangles
-        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
-        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-
-        draw_list_3d._IdxWritePtr[3] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[4] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-        draw_list_3d._IdxWritePtr[5] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 3);
-
-        draw_list_3d._IdxWritePtr += 6;
+        draw_list_3d._PosWritePtr += 4;
 
         // Add depth value for the quad
         double z = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2] + p_plot[3]) / 4.0);
         draw_list_3d._ZWritePtr[0] = z;
-        draw_list_3d._ZWritePtr[1] = z;
-        draw_list_3d._ZWritePtr += 2;
+        draw_list_3d._ZWritePtr++;
 
         // Update vertex count
         draw_list_3d._VtxCurrentIdx += 4;
@@ -751,27 +1030,21 @@ template <class _Getter> struct RendererQuadImage : RendererBase {
 };
 
 template <class _Getter> struct RendererSurfaceFill : RendererBase {
-    RendererSurfaceFill(const _Getter& getter, int x_count, int y_count, ImU32 col, double scale_min, double scale_max)
-        : RendererBase((x_count - 1) * (y_count - 1), 6, 4), Getter(getter), Min(0.), Max(0.), XCount(x_count), YCount(y_count), Col(col),
-          ScaleMin(scale_min), ScaleMax(scale_max) {}
+    // With #vtx_cols (e.g. colormapped values), each vertex takes the color of the grid point it was read from, otherwise the surface is filled
+    // with #col
+    RendererSurfaceFill(const _Getter& getter, int x_count, int y_count, ImU32 col, const ImU32* vtx_cols)
+        : RendererBase((x_count - 1) * (y_count - 1), 6, 4), Getter(getter), XCount(x_count), YCount(y_count), Col(col), VtxCols(vtx_cols) {}
 
     void Init(ImDrawList3D& draw_list_3d) const {
-        UV = draw_list_3d._SharedData->TexUvWhitePixel;
-
-        // Compute min and max values for the colormap (if not solid fill)
-        const ImPlot3DNextItemData& n = GetItemData();
-        if (n.IsAutoFill) {
-            Min = DBL_MAX;
-            Max = -DBL_MAX;
-            for (int i = 0; i < Getter.Count; i++) {
-                double z = Getter(i).z;
-                Min = ImMin(Min, z);
-                Max = ImMax(Max, z);
-            }
-        }
+        // Non-planar quads, sort each triangle on its own
+        draw_list_3d.SetPrimFan(4, true);
+        if (VtxCols != nullptr)
+            draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        else
+            draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
     }
 
-    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
         int x = prim % (XCount - 1);
         int y = prim / (XCount - 1);
 
@@ -785,22 +1058,13 @@ template <class _Getter> struct RendererSurfaceFill : RendererBase {
         if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]) && !cull_box.Contains(p_plot[3]))
             return false;
 
-        // Compute colors
-        ImU32 cols[4] = {Col, Col, Col, Col};
-        const ImPlot3DNextItemData& n = GetItemData();
-        if (n.IsAutoFill) {
-            float alpha = GImPlot3D->NextItemData.Spec.FillAlpha;
-            double min = Min;
-            double max = Max;
-            if (ScaleMin != 0.0 || ScaleMax != 0.0) {
-                min = ScaleMin;
-                max = ScaleMax;
-            }
-            for (int i = 0; i < 4; i++) {
-                ImVec4 col = SampleColormap((float)ImClamp(ImRemap01(p_plot[i].z, min, max), 0.0, 1.0));
-                col.w *= alpha;
-                cols[i] = ImGui::ColorConvertFloat4ToU32(col);
-            }
+        // Vertex colors
+        if (VtxCols != nullptr) {
+            draw_list_3d._ColWritePtr[0] = VtxCols[Getter.VertexIndex(x + y * XCount)];
+            draw_list_3d._ColWritePtr[1] = VtxCols[Getter.VertexIndex(x + 1 + y * XCount)];
+            draw_list_3d._ColWritePtr[2] = VtxCols[Getter.VertexIndex(x + 1 + (y + 1) * XCount)];
+            draw_list_3d._ColWritePtr[3] = VtxCols[Getter.VertexIndex(x + (y + 1) * XCount)];
+            draw_list_3d._ColWritePtr += 4;
         }
 
         // Project the quad vertices to screen space
@@ -811,38 +1075,19 @@ template <class _Getter> struct RendererSurfaceFill : RendererBase {
         p[3] = PlotToPixels(p_plot[3]);
 
         // Add vertices for two triangles
-        draw_list_3d._VtxWritePtr[0].pos.x = p[0].x;
-        draw_list_3d._VtxWritePtr[0].pos.y = p[0].y;
-        draw_list_3d._VtxWritePtr[0].uv = UV;
-        draw_list_3d._VtxWritePtr[0].col = cols[0];
-
-        draw_list_3d._VtxWritePtr[1].pos.x = p[1].x;
-        draw_list_3d._VtxWritePtr[1].pos.y = p[1].y;
-        draw_list_3d._VtxWritePtr[1].uv = UV;
-        draw_list_3d._VtxWritePtr[1].col = cols[1];
+        draw_list_3d._PosWritePtr[0].x = p[0].x;
+        draw_list_3d._PosWritePtr[0].y = p[0].y;
 
-        draw_list_3d._VtxWritePtr[2].pos.x = p[2].x;
-        draw_list_3d._VtxWritePtr[2].pos.y = p[2].y;
-        draw_list_3d._VtxWritePtr[2].uv = UV;
-        draw_list_3d._VtxWritePtr[2].col = cols[2];
+        draw_list_3d._PosWritePtr[1].x = p[1].x;
+        draw_list_3d._PosWritePtr[1].y = p[1].y;
 
-        draw_list_3d._VtxWritePtr[3].pos.x = p[3].x;
-        draw_list_3d._VtxWritePtr[3].pos.y = p[3].y;
-        draw_list_3d._VtxWritePtr[3].uv = UV;
-        draw_list_3d._VtxWritePtr[3].col = cols[3];
+        draw_list_3d._PosWritePtr[2].x = p[2].x;
+        draw_list_3d._PosWritePtr[2].y = p[2].y;
 
-        draw_list_3d._VtxWritePtr += 4;
+        draw_list_3d._PosWritePtr[3].x = p[3].x;
+        draw_list_3d._PosWritePtr[3].y = p[3].y;
 
-        // Add indices for two triangles
-        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
-        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-
-        draw_list_3d._IdxWritePtr[3] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
-        draw_list_3d._IdxWritePtr[4] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
-        draw_list_3d._IdxWritePtr[5] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 3);
-
-        draw_list_3d._IdxWritePtr += 6;
+        draw_list_3d._PosWritePtr += 4;
 
         // Add depth values for the two triangles
         draw_list_3d._ZWritePtr[0] = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2]) / 3.0);
@@ -856,14 +1101,188 @@ template <class _Getter> struct RendererSurfaceFill : RendererBase {
     }
 
     const _Getter& Getter;
-    mutable ImVec2 UV;
-    mutable double Min; // Minimum value for the colormap
-    mutable double Max; // Maximum value for the colormap
     const int XCount;
     const int YCount;
     const ImU32 Col;
-    const double ScaleMin;
-    const double ScaleMax;
+    const ImU32* VtxCols;
+};
+
+template <class _Getter> struct RendererWaterfallFill : RendererBase {
+    RendererWaterfallFill(const _Getter& getter, ImU32 col, bool colormapped)
+        : RendererBase((getter.Waterfall.BinCount - 1) * (getter.Waterfall.RowCount - 1), 6, 4), Getter(getter), Waterfall(getter.Waterfall),
+          Col(col), Colormapped(colormapped) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        // Non-planar quads, sort each triangle on its own
+        draw_list_3d.SetPrimFan(4, true);
+        if (Colormapped)
+            draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        else
+            draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        const int bins = Waterfall.BinCount;
+        int x = prim % (bins - 1);
+        int age = prim / (bins - 1);
+
+        ImPlot3DPoint p_plot[4];
+        p_plot[0] = Getter(x + age * bins);
+        p_plot[1] = Getter(x + 1 + age * bins);
+        p_plot[2] = Getter(x + 1 + (age + 1) * bins);
+        p_plot[3] = Getter(x + (age + 1) * bins);
+
+        // Check if the quad is outside the culling box
+        if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]) && !cull_box.Contains(p_plot[3]))
+            return false;
+
+        // Look up the cached projections of the two rows and shift them to the current row positions
+        const int row0 = Waterfall.GetSlot(age) * bins;
+        const int row1 = Waterfall.GetSlot(age + 1) * bins;
+        const int idx[4] = {row0 + x, row0 + x + 1, row1 + x + 1, row1 + x};
+        const ImVec2 shift0 = Waterfall.RowPixShift[age];
+        const ImVec2 shift1 = Waterfall.RowPixShift[age + 1];
+        const ImVec2 p[4] = {Waterfall.PixPos[idx[0]] + shift0, Waterfall.PixPos[idx[1]] + shift0, Waterfall.PixPos[idx[2]] + shift1,
+                             Waterfall.PixPos[idx[3]] + shift1};
+        const double z[4] = {Waterfall.PixDepth[idx[0]] + Waterfall.RowZShift[age], Waterfall.PixDepth[idx[1]] + Waterfall.RowZShift[age],
+                             Waterfall.PixDepth[idx[2]] + Waterfall.RowZShift[age + 1], Waterfall.PixDepth[idx[3]] + Waterfall.RowZShift[age + 1]};
+
+        // Add vertices for two triangles
+        for (int i = 0; i < 4; i++)
+            draw_list_3d._PosWritePtr[i] = p[i];
+        draw_list_3d._PosWritePtr += 4;
+        if (Colormapped) {
+            for (int i = 0; i < 4; i++)
+                draw_list_3d._ColWritePtr[i] = Waterfall.Colors[idx[i]];
+            draw_list_3d._ColWritePtr += 4;
+        }
+
+        // Add depth values for the two triangles (depth is linear, so the centroid depth is the mean of the vertex depths)
+        draw_list_3d._ZWritePtr[0] = (z[0] + z[1] + z[2]) / 3.0;
+        draw_list_3d._ZWritePtr[1] = (z[0] + z[2] + z[3]) / 3.0;
+        draw_list_3d._ZWritePtr += 2;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 4;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImPlot3DWaterfall& Waterfall;
+    const ImU32 Col;
+    const bool Colormapped;
+};
+
+template <class _Getter> struct RendererWaterfallLines : RendererBase {
+    RendererWaterfallLines(const _Getter& getter, ImU32 col, float weight)
+        : RendererBase((getter.Waterfall.BinCount - 1) * getter.Waterfall.RowCount + getter.Waterfall.BinCount * (getter.Waterfall.RowCount - 1), 6,
+                       4),
+          Getter(getter), Waterfall(getter.Waterfall), Col(col), HalfWeight(ImMax(1.0f, weight) * 0.5f) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const { SetLineRenderProps(draw_list_3d, HalfWeight, Col); }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        // Horizontal segments (along each row) first, then vertical segments (between consecutive rows)
+        const int bins = Waterfall.BinCount;
+        const int horizontal_segments = (bins - 1) * Waterfall.RowCount;
+        int age1, bin1, age2, bin2;
+        if (prim < horizontal_segments) {
+            age1 = age2 = prim / (bins - 1);
+            bin1 = prim % (bins - 1);
+            bin2 = bin1 + 1;
+        } else {
+            age1 = (prim - horizontal_segments) / bins;
+            age2 = age1 + 1;
+            bin1 = bin2 = (prim - horizontal_segments) % bins;
+        }
+        ImPlot3DPoint P1_plot = Getter(age1 * bins + bin1);
+        ImPlot3DPoint P2_plot = Getter(age2 * bins + bin2);
+
+        // Fully visible segments use the cached projections
+        if (cull_box.Contains(P1_plot) && cull_box.Contains(P2_plot)) {
+            const int idx1 = Waterfall.GetSlot(age1) * bins + bin1;
+            const int idx2 = Waterfall.GetSlot(age2) * bins + bin2;
+            ImVec2 P1_screen = Waterfall.PixPos[idx1] + Waterfall.RowPixShift[age1];
+            ImVec2 P2_screen = Waterfall.PixPos[idx2] + Waterfall.RowPixShift[age2];
+            double z = (Waterfall.PixDepth[idx1] + Waterfall.RowZShift[age1] + Waterfall.PixDepth[idx2] + Waterfall.RowZShift[age2]) * 0.5;
+            PrimLine(draw_list_3d, P1_screen, P2_screen, HalfWeight, z);
+            return true;
+        }
+
+        // Partially visible segments are clipped and projected as in RendererLineSegments
+        if (ImNan(P1_plot.z) || ImNan(P2_plot.z))
+            return false;
+        ImPlot3DPoint P1_clipped, P2_clipped;
+        if (!cull_box.ClipLineSegment(P1_plot, P2_plot, P1_clipped, P2_clipped))
+            return false;
+        PrimLine(draw_list_3d, PlotToPixels(P1_clipped), PlotToPixels(P2_clipped), HalfWeight,
+                 GetPointDepth((P1_plot + P2_plot) * 0.5));
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImPlot3DWaterfall& Waterfall;
+    const ImU32 Col;
+    mutable float HalfWeight;
+};
+
+template <class _Getter> struct RendererHeatmapCells : RendererBase {
+    // The getter provides the 4 corners of the heatmap rectangle, #colors holds one color per cell
+    RendererHeatmapCells(const _Getter& getter, int rows, int cols, const ImU32* colors)
+        : RendererBase(rows * cols, 6, 4), Getter(getter), Rows(rows), Cols(cols), Colors(colors) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(4);
+        draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        Origin = Getter(0);
+        StepU = (Getter(1) - Getter(0)) / (double)Cols;
+        StepV = (Getter(3) - Getter(0)) / (double)Rows;
+    }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        int col = prim % Cols;
+        int row = prim / Cols;
+
+        ImPlot3DPoint p_plot[4];
+        p_plot[0] = Origin + StepU * (double)col + StepV * (double)row;
+        p_plot[1] = p_plot[0] + StepU;
+        p_plot[2] = p_plot[1] + StepV;
+        p_plot[3] = p_plot[0] + StepV;
+
+        // Check if the cell is outside the culling box
+        if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]) && !cull_box.Contains(p_plot[3]))
+            return false;
+
+        // Add vertices for two triangles
+        const ImU32 cell_col = Colors[prim];
+        for (int i = 0; i < 4; i++) {
+            ImVec2 p = PlotToPixels(p_plot[i]);
+            draw_list_3d._PosWritePtr[i].x = p.x;
+            draw_list_3d._PosWritePtr[i].y = p.y;
+            draw_list_3d._ColWritePtr[i] = cell_col;
+        }
+        draw_list_3d._PosWritePtr += 4;
+        draw_list_3d._ColWritePtr += 4;
+
+        // Add depth value for the cell
+        double z = GetPointDepth((p_plot[0] + p_plot[2]) * 0.5);
+        draw_list_3d._ZWritePtr[0] = z;
+        draw_list_3d._ZWritePtr++;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 4;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    const int Rows;
+    const int Cols;
+    const ImU32* Colors;
+    mutable ImPlot3DPoint Origin;
+    mutable ImPlot3DPoint StepU;
+    mutable ImPlot3DPoint StepV;
 };
 
 //-----------------------------------------------------------------------------
@@ -891,6 +1310,24 @@ template <typename T> struct IndexerIdx {
     int Stride;
 };
 
+// Indexes a grid stored as a circular buffer of rows. Whole rows are rotated, so the grid is read as two contiguous blocks of values, from the
+// first value of the offset row to the end of the buffer, followed by the values before it. Each element costs an addition and a comparison, with
+// no per-element division or modulo
+template <typename T> struct IndexerRows {
+    IndexerRows(const T* data, int x_count, int y_count, int row_offset, int stride)
+        : Data(data), Count(x_count * y_count), Split(y_count ? ImPosMod(row_offset, y_count) * x_count : 0), Stride(stride) {}
+    template <typename I> IMPLOT3D_INLINE double operator()(I idx) const {
+        int i = (int)idx + Split;
+        if (i >= Count)
+            i -= Count;
+        return (double)IndexData(Data, i, Count, 0, Stride);
+    }
+    const T* Data;
+    int Count;
+    int Split; // Index of the first value of the grid in the buffer (first value of the offset row)
+    int Stride;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Getters
 //-----------------------------------------------------------------------------
@@ -906,30 +1343,28 @@ template <typename _IndexerX, typename _IndexerY, typename _IndexerZ> struct Get
 
 template <typename _Getter> struct GetterLoop {
     GetterLoop(_Getter getter) : Getter(getter), Count(getter.Count + 1) {}
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        idx = idx % (Count - 1);
-        return Getter(idx);
-    }
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Getter(idx % (Count - 1)); }
+    template <typename I> IMPLOT3D_INLINE I VertexIndex(I idx) const { return (I)Getter.VertexIndex(idx % (Count - 1)); }
     const _Getter Getter;
     const int Count;
 };
 
 template <typename _Getter> struct GetterTriangleLines {
     GetterTriangleLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        idx = ((idx % 6 + 1) / 2) % 3 + idx / 6 * 3;
-        return Getter(idx);
-    }
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Getter(PointIndex(idx)); }
+    template <typename I> IMPLOT3D_INLINE I VertexIndex(I idx) const { return (I)Getter.VertexIndex(PointIndex(idx)); }
+    // Index of the triangle point read for line endpoint #idx
+    template <typename I> IMPLOT3D_INLINE I PointIndex(I idx) const { return ((idx % 6 + 1) / 2) % 3 + idx / 6 * 3; }
     const _Getter Getter;
     const int Count;
 };
 
 template <typename _Getter> struct GetterQuadLines {
     GetterQuadLines(_Getter getter) : Getter(getter), Count(getter.Count * 2) {}
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        idx = ((idx % 8 + 1) / 2) % 4 + idx / 8 * 4;
-        return Getter(idx);
-    }
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Getter(PointIndex(idx)); }
+    template <typename I> IMPLOT3D_INLINE I VertexIndex(I idx) const { return (I)Getter.VertexIndex(PointIndex(idx)); }
+    // Index of the quad point read for line endpoint #idx
+    template <typename I> IMPLOT3D_INLINE I PointIndex(I idx) const { return ((idx % 8 + 1) / 2) % 4 + idx / 8 * 4; }
     const _Getter Getter;
     const int Count;
 };
@@ -942,8 +1377,11 @@ template <typename _Getter> struct GetterSurfaceLines {
         Count = segments * 2; // Each segment has 2 endpoints
     }
 
-    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
-        // idx is an endpoint index
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Getter(PointIndex(idx)); }
+    template <typename I> IMPLOT3D_INLINE int VertexIndex(I idx) const { return (int)Getter.VertexIndex(PointIndex(idx)); }
+
+    // Index of the grid point read for line endpoint #idx
+    template <typename I> IMPLOT3D_INLINE int PointIndex(I idx) const {
         int endpoint_i = (int)(idx % 2);
         int segment_i = (int)(idx / 2);
 
@@ -967,7 +1405,7 @@ template <typename _Getter> struct GetterSurfaceLines {
             py = row + endpoint_i;
         }
 
-        return Getter(py * XCount + px);
+        return py * XCount + px;
     }
 
     const _Getter Getter;
@@ -979,10 +1417,21 @@ template <typename _Getter> struct GetterSurfaceLines {
 struct Getter3DPoints {
     Getter3DPoints(const ImPlot3DPoint* points, int count) : Points(points), Count(count) {}
     template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Points[idx]; }
+    template <typename I> IMPLOT3D_INLINE I VertexIndex(I idx) const { return idx; }
     const ImPlot3DPoint* Points;
     const int Count;
 };
 
+// Points of #getter moved from model to plot coordinates by a model transform
+template <typename _Getter> struct GetterModel {
+    GetterModel(_Getter getter, const ImPlot3DModelTransform& model) : Getter(getter), Model(model), Count(getter.Count) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Model.Apply(Getter(idx)); }
+    template <typename I> IMPLOT3D_INLINE unsigned int VertexIndex(I idx) const { return (unsigned int)Getter.VertexIndex(idx); }
+    const _Getter Getter;
+    const ImPlot3DModelTransform Model;
+    const int Count;
+};
+
 struct GetterMeshTriangles {
     GetterMeshTriangles(const ImPlot3DPoint* vtx, const unsigned int* idx, int idx_count)
         : Vtx(vtx), Idx(idx), IdxCount(idx_count), TriCount(idx_count / 3), Count(idx_count) {}
@@ -991,6 +1440,7 @@ struct GetterMeshTriangles {
         unsigned int vi = Idx[i];
         return Vtx[vi];
     }
+    template <typename I> IMPLOT3D_INLINE unsigned int VertexIndex(I i) const { return Idx[i]; }
 
     const ImPlot3DPoint* Vtx;
     const unsigned int* Idx;
@@ -999,15 +1449,127 @@ struct GetterMeshTriangles {
     int Count;
 };
 
+struct GetterWaterfall {
+    GetterWaterfall(const ImPlot3DWaterfall& waterfall, double row_step)
+        : Waterfall(waterfall), RowStep(row_step), Count(waterfall.RowCount * waterfall.BinCount) {}
+
+    // idx = age * BinCount + bin, where age 0 is the newest row
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        int age = (int)(idx / Waterfall.BinCount);
+        int bin = (int)(idx % Waterfall.BinCount);
+        return ImPlot3DPoint(Waterfall.Xs[bin], age * RowStep, Waterfall.GetValue(age, bin));
+    }
+
+    const ImPlot3DWaterfall& Waterfall;
+    const double RowStep;
+    const int Count;
+};
+
+template <typename _Getter> struct GetterScaled {
+    // Reads the points from #points (see GetScaledPoints) if provided, otherwise from #getter. With a #stride greater than 1 (see GetLODStride),
+    // only one out of every #stride groups of #group_size points is read (e.g. 3 for triangles), or one out of every #stride rows and columns
+    // if the points form a grid with #row_size points per row
+    GetterScaled(const _Getter& getter, const ImPlot3DPoint* points, int stride = 1, int group_size = 1, int row_size = 0)
+        : Getter(getter), Points(points), Stride(stride), GroupSize(group_size), RowSize(row_size),
+          SampledRowSize(row_size > 0 ? (row_size - 1) / stride + 1 : 0),
+          Count(stride == 1   ? getter.Count
+                : row_size > 0 ? SampledRowSize * ((getter.Count / row_size - 1) / stride + 1)
+                               : (getter.Count / group_size + stride - 1) / stride * group_size) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        idx = VertexIndex(idx);
+        return Points != nullptr ? Points[idx] : Getter(idx);
+    }
+    // Index of the data point read for #idx, to look up per-vertex attributes (e.g. colors)
+    template <typename I> IMPLOT3D_INLINE I VertexIndex(I idx) const {
+        if (Stride != 1)
+            idx = RowSize > 0 ? (I)((idx % SampledRowSize) * Stride + (idx / SampledRowSize) * Stride * RowSize)
+                              : (I)((idx / GroupSize) * GroupSize * Stride + idx % GroupSize);
+        return idx;
+    }
+    const _Getter& Getter;
+    const ImPlot3DPoint* Points;
+    const int Stride;
+    const int GroupSize;
+    const int RowSize;
+    const int SampledRowSize;
+    const int Count;
+};
+
+// Returns the stride the current item samples its data with to fit the interactive LOD budget of the plot (see SetupInteractiveLOD), or 1 if
+// the LOD is not active. #count is the number of points (or triangles if not #points) the item renders at full quality, and with #grid the
+// stride applies to both dimensions of a grid. The budget is shared by the items in proportion to the data they requested in the last frame
+static int GetLODStride(int count, bool points, bool grid) {
+    ImPlot3DPlot& plot = *GImPlot3D->CurrentPlot;
+    int& requested = points ? plot.Stats.PointsRequested : plot.Stats.TrisRequested;
+    requested += count;
+    if (!plot.IsLODActive())
+        return 1;
+    const int budget = points ? plot.LODPointBudget : plot.LODTriBudget;
+    const int total = ImMax(points ? plot.LODPrevPointCount : plot.LODPrevTriCount, requested);
+    if (total <= budget)
+        return 1;
+    double ratio = (double)total / (double)budget;
+    if (grid)
+        ratio = ImSqrt(ratio);
+    return (int)ImCeil((float)ratio);
+}
+
+// Returns the points of #getter transformed by the axis scales, cached for the current item while its data version and the axis scales don't
+// change. Rotating, panning and zooming then only remap the cached points linearly. Returns nullptr (and renders from the getter) when the item
+// has no data version or all axes are linear. Must be called after BeginItem(), the plot stays in pre-scaled mode until EndItem()
+template <typename _Getter> const ImPlot3DPoint* GetScaledPoints(const _Getter& getter) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const int version = GetItemData().Spec.DataVersion;
+    if (version < 0)
+        return nullptr;
+    bool scaled = false;
+    for (int i = 0; i < 3; i++)
+        scaled |= plot.Axes[i].TransformForward != nullptr;
+    if (!scaled)
+        return nullptr;
+
+    // Transform the points again only if the data or the scales changed
+    ImPlot3DScaledPoints* cache = gp.CurrentItems->GetOrAddScaledPoints(GetCurrentItem()->ID);
+    bool dirty = cache->DataVersion != version || cache->Points.Size != getter.Count;
+    for (int i = 0; i < 3; i++)
+        dirty |= cache->Transforms[i] != plot.Axes[i].TransformForward || cache->TransformData[i] != plot.Axes[i].TransformData;
+    if (dirty) {
+        cache->Points.resize(getter.Count);
+        for (int i = 0; i < 3; i++) {
+            cache->Transforms[i] = plot.Axes[i].TransformForward;
+            cache->TransformData[i] = plot.Axes[i].TransformData;
+        }
+        cache->DataVersion = version;
+        for (int idx = 0; idx < getter.Count; idx++)
+            cache->Points[idx] = getter(idx);
+        // Transform each scaled coordinate in blocks, so that the batched transforms of the built-in scales can be vectorized
+        const int block_size = 256;
+        double block[block_size];
+        for (int i = 0; i < 3; i++) {
+            if (cache->Transforms[i] == nullptr)
+                continue;
+            for (int first = 0; first < getter.Count; first += block_size) {
+                const int n = ImMin(block_size, getter.Count - first);
+                ImPlot3DPoint* points = cache->Points.Data + first;
+                for (int j = 0; j < n; j++)
+                    block[j] = points[j][i];
+                AxisTransformForwardBatch(plot.Axes[i], block, block, n);
+                for (int j = 0; j < n; j++)
+                    points[j][i] = block[j];
+            }
+        }
+    }
+    plot.PreScaled = true;
+    return cache->Points.Data;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes
-template <template <class> class _Renderer, class _Getter, typename... Args> void RenderPrimitives(const _Getter& getter, Args... args) {
-    _Renderer<_Getter> renderer(getter, args...);
-    ImPlot3DPlot& plot = *GetCurrentPlot();
-    ImDrawList3D& draw_list_3d = plot.DrawList;
+// Returns the box outside of which points are culled, in the same space as the points being rendered
+static ImPlot3DBox GetCullBox(const ImPlot3DPlot& plot) {
     ImPlot3DBox cull_box;
     if (ImHasFlag(plot.Flags, ImPlot3DFlags_NoClip)) {
         cull_box.Min = ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL);
@@ -1015,40 +1577,201 @@ template <template <class> class _Renderer, class _Getter, typename... Args> voi
     } else {
         cull_box.Min = plot.RangeMin();
         cull_box.Max = plot.RangeMax();
+        if (plot.PreScaled) {
+            // Points are in scaled space, so is the culling box
+            for (int i = 0; i < 3; i++) {
+                const ImPlot3DAxis& axis = plot.Axes[i];
+                if (axis.TransformForward != nullptr) {
+                    cull_box.Min[i] = ImMin(axis.ScaledRange.Min, axis.ScaledRange.Max);
+                    cull_box.Max[i] = ImMax(axis.ScaledRange.Min, axis.ScaledRange.Max);
+                }
+            }
+        }
     }
+    return cull_box;
+}
 
-    // Find how many can be reserved up to end of current draw command's limit
-    unsigned int prims_to_render = ImMin(renderer.Prims, (ImDrawList3D::MaxIdx() - draw_list_3d._VtxCurrentIdx) / renderer.VtxConsumed);
+// Culling box that accepts every primitive, used instead of the plot box when the whole item is known to be inside it
+struct NoCullBox {
+    IMPLOT3D_INLINE bool Contains(const ImPlot3DPoint&) const { return true; }
+    IMPLOT3D_INLINE bool ClipLineSegment(const ImPlot3DPoint& p0, const ImPlot3DPoint& p1, ImPlot3DPoint& p0_clipped,
+                                         ImPlot3DPoint& p1_clipped) const {
+        p0_clipped = p0;
+        p1_clipped = p1;
+        return true;
+    }
+};
 
-    // Reserve vertices and indices to render the primitives
-    draw_list_3d.PrimReserve(prims_to_render * renderer.IdxConsumed, prims_to_render * renderer.VtxConsumed);
+enum ItemCull {
+    ItemCull_Partial, // The item may cross the plot box, each primitive is culled
+    ItemCull_Inside,  // The item is fully inside the plot box, no primitive is culled
+    ItemCull_Outside, // The item is fully outside the plot box, all primitives are culled
+};
 
-    // Initialize renderer
-    renderer.Init(draw_list_3d);
+// Tests the bounds of the current item data (see BeginItemEx) against the plot box, to accept or reject all of its primitives at once
+static ItemCull GetItemCull(const ImPlot3DPlot& plot) {
+    const ImPlot3DNextItemData& n = GetItemData();
+    if (GetCurrentItem() == nullptr || !n.HasBounds)
+        return ItemCull_Partial;
+    if (ImHasFlag(plot.Flags, ImPlot3DFlags_NoClip))
+        return ItemCull_Inside;
+    // The bounds are in plot coordinates while the points may be pre-scaled, but the axis scales are monotonic so the result is the same
+    bool inside = true;
+    for (int i = 0; i < 3; i++) {
+        const ImPlot3DRange& range = plot.Axes[i].Range;
+        if (n.Bounds.Max[i] < range.Min || n.Bounds.Min[i] > range.Max)
+            return ItemCull_Outside;
+        inside &= n.Bounds.Min[i] >= range.Min && n.Bounds.Max[i] <= range.Max;
+    }
+    return inside ? ItemCull_Inside : ItemCull_Partial;
+}
 
-    // Render primitives
-    int num_culled = 0;
-    for (unsigned int i = 0; i < prims_to_render; i++)
-        if (!renderer.Render(draw_list_3d, cull_box, i))
-            num_culled++;
-    // Unreserve unused vertices and indices
-    draw_list_3d.PrimUnreserve(num_culled * renderer.IdxConsumed, num_culled * renderer.VtxConsumed);
+// Returns the ID of the current item combined with its render state (colors, line weight, marker size and colormap), so that the progressive
+// refinement restarts when the item is restyled (e.g. highlighted from the legend). Returns 0 outside of an item
+static ImGuiID GetItemRenderID() {
+    const ImPlot3DItem* item = GetCurrentItem();
+    if (item == nullptr)
+        return 0;
+    const ImPlot3DSpec& s = GetItemData().Spec;
+    const ImVec4 colors[4] = {s.LineColor, s.FillColor, s.MarkerLineColor, s.MarkerFillColor};
+    const float sizes[2] = {s.LineWeight, s.MarkerSize};
+    const int styles[2] = {s.Marker, GImPlot3D->Style.Colormap};
+    ImGuiID id = ImHashData(colors, sizeof(colors), item->ID);
+    id = ImHashData(sizes, sizeof(sizes), id);
+    return ImHashData(styles, sizeof(styles), id);
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] Markers
-//-----------------------------------------------------------------------------
+// Renders the next primitives of #call that fit in the frame budget, appending them to the geometry retained from the previous frames. The
+// primitives are visited in interleaved passes (0, stride, 2 * stride..., then 1, stride + 1...) so that the first frames show a coarse subset
+template <class _Renderer, class _CullBox>
+void RenderPrimitivesProgressive(const _Renderer& renderer, const _CullBox& cull_box, unsigned int prims_max, ImPlot3DProgressiveCall& call) {
+    ImPlot3DPlot& plot = *GetCurrentPlot();
+    ImDrawList3D& draw_list_3d = plot.DrawList;
+    ImPlot3DProgressive& prog = plot.Progressive;
 
-static const ImVec2 MARKER_FILL_CIRCLE[10] = {ImVec2(1.0f, 0.0f),
-                                              ImVec2(0.809017f, 0.58778524f),
-                                              ImVec2(0.30901697f, 0.95105654f),
-                                              ImVec2(-0.30901703f, 0.9510565f),
-                                              ImVec2(-0.80901706f, 0.5877852f),
+    // Primitives that still fit in the budget and in the ImDrawIdx range
+    const int prims_to_render = ImMin(prog.GetCallBudget(call), (int)ImMin(prims_max, (unsigned int)call.Count));
+    if (prims_to_render <= 0)
+        return;
+    draw_list_3d.PrimReserve(prims_to_render * renderer.IdxConsumed, prims_to_render * renderer.VtxConsumed);
+
+    // Render primitives, checking the time budget every few of them
+    const int check_interval = 1024;
+    int num_rendered = 0;
+    int num_culled = 0;
+    while (num_rendered < prims_to_render) {
+        const int chunk_end = ImMin(num_rendered + check_interval, prims_to_render);
+        for (; num_rendered < chunk_end; num_rendered++) {
+            renderer.Seek(call.Next);
+            if (!renderer.Render(draw_list_3d, cull_box, call.Next))
+                num_culled++;
+            call.Next += call.Stride;
+            if (call.Next >= call.Count) {
+                call.Pass++;
+                call.Next = call.Pass;
+            }
+        }
+        if (prog.IsOutOfTime()) {
+            prog.PrimsLeft = 0;
+            break;
+        }
+    }
+    call.Done += num_rendered;
+    prog.PrimsLeft = ImMax(prog.PrimsLeft - num_rendered, 0);
+
+    // Unreserve unused vertices and indices
+    const int num_unused = prims_to_render - num_rendered + num_culled;
+    draw_list_3d.PrimUnreserve(num_unused * renderer.IdxConsumed, num_unused * renderer.VtxConsumed);
+
+    plot.Stats.PrimsRendered += num_rendered - num_culled;
+    plot.Stats.PrimsCulled += num_culled;
+}
+
+// Renders the first #prims_to_render primitives, culling them against #cull_box
+template <class _Renderer, class _CullBox>
+void RenderPrimitivesCulled(const _Renderer& renderer, const _CullBox& cull_box, unsigned int prims_to_render) {
+    ImPlot3DPlot& plot = *GetCurrentPlot();
+    ImDrawList3D& draw_list_3d = plot.DrawList;
+
+    // Reserve vertices and indices to render the primitives
+    draw_list_3d.PrimReserve(prims_to_render * renderer.IdxConsumed, prims_to_render * renderer.VtxConsumed);
+
+    // Render primitives
+    int num_culled = 0;
+    for (unsigned int i = 0; i < prims_to_render; i++)
+        if (!renderer.Render(draw_list_3d, cull_box, i))
+            num_culled++;
+    // Unreserve unused vertices and indices
+    draw_list_3d.PrimUnreserve(num_culled * renderer.IdxConsumed, num_culled * renderer.VtxConsumed);
+
+    plot.Stats.PrimsRendered += (int)prims_to_render - num_culled;
+    plot.Stats.PrimsCulled += num_culled;
+}
+
+/// Renders primitive shapes
+template <template <class> class _Renderer, class _Getter, typename... Args> void RenderPrimitives(const _Getter& getter, Args... args) {
+    _Renderer<_Getter> renderer(getter, args...);
+    ImPlot3DPlot& plot = *GetCurrentPlot();
+    ImDrawList3D& draw_list_3d = plot.DrawList;
+    const ImPlot3DBox cull_box = GetCullBox(plot);
+    const ItemCull item_cull = GetItemCull(plot);
+
+    // Find how many can be reserved up to end of current draw command's limit
+    unsigned int prims_to_render = ImMin(renderer.Prims, (ImDrawList3D::MaxIdx() - draw_list_3d._VtxCurrentIdx) / renderer.VtxConsumed);
+
+    // Initialize renderer (sets the vertex style and primitive fan, which determine whether vertex colors and indices are reserved)
+    renderer.Init(draw_list_3d);
+    // Each call of a pre-sorted item is its own back to front sequence (e.g. fill and lines)
+    draw_list_3d.SetSortMode(GetItemSortMode());
+
+    // Custom geometry (see AddTriangles3D) is rendered outside of any item and has no data version
+    ImPlot3DProgressive& prog = plot.Progressive;
+    const ImPlot3DItem* item = GetCurrentItem();
+    const int data_version = item != nullptr ? GetItemData().Spec.DataVersion : -1;
+    if (data_version < 0)
+        prog.AllVersioned = false;
+
+    // Items fully inside the plot box skip the per-primitive culling, and items fully outside aren't rendered at all
+    const int prims_rendered = plot.Stats.PrimsRendered;
+    if (prog.Active) {
+        ImPlot3DProgressiveCall& call = prog.NextCall(GetItemRenderID(), data_version, (int)renderer.Prims);
+        if (item_cull == ItemCull_Outside) {
+            plot.Stats.PrimsCulled += call.Count - call.Done;
+            call.Done = call.Count;
+        } else if (item_cull == ItemCull_Inside) {
+            RenderPrimitivesProgressive(renderer, NoCullBox(), prims_to_render, call);
+        } else {
+            RenderPrimitivesProgressive(renderer, cull_box, prims_to_render, call);
+        }
+    } else {
+        if (item_cull == ItemCull_Outside)
+            plot.Stats.PrimsCulled += (int)prims_to_render;
+        else if (item_cull == ItemCull_Inside)
+            RenderPrimitivesCulled(renderer, NoCullBox(), prims_to_render);
+        else
+            RenderPrimitivesCulled(renderer, cull_box, prims_to_render);
+        plot.Stats.PrimsDropped += (int)(renderer.Prims - prims_to_render);
+    }
+    if (item_cull == ItemCull_Inside)
+        plot.Stats.PrimsUnclipped += plot.Stats.PrimsRendered - prims_rendered;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Markers
+//-----------------------------------------------------------------------------
+
+static const ImVec2 MARKER_FILL_CIRCLE[10] = {ImVec2(1.0f, 0.0f),
+                                              ImVec2(0.809017f, 0.58778524f),
+                                              ImVec2(0.30901697f, 0.95105654f),
+                                              ImVec2(-0.30901703f, 0.9510565f),
+                                              ImVec2(-0.80901706f, 0.5877852f),
                                               ImVec2(-1.0f, 0.0f),
                                               ImVec2(-0.80901694f, -0.58778536f),
                                               ImVec2(-0.3090171f, -0.9510565f),
                                               ImVec2(0.30901712f, -0.9510565f),
                                               ImVec2(0.80901694f, -0.5877853f)};
+static const ImVec2 MARKER_FILL_HEXAGON[6] = {ImVec2(1, 0),  ImVec2(0.5f, SQRT_3_2),   ImVec2(-0.5f, SQRT_3_2),
+                                              ImVec2(-1, 0), ImVec2(-0.5f, -SQRT_3_2), ImVec2(0.5f, -SQRT_3_2)};
 static const ImVec2 MARKER_FILL_SQUARE[4] = {ImVec2(SQRT_1_2, SQRT_1_2), ImVec2(SQRT_1_2, -SQRT_1_2), ImVec2(-SQRT_1_2, -SQRT_1_2),
                                              ImVec2(-SQRT_1_2, SQRT_1_2)};
 static const ImVec2 MARKER_FILL_DIAMOND[4] = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
@@ -1076,6 +1799,10 @@ static const ImVec2 MARKER_LINE_CIRCLE[20] = {ImVec2(1.0f, 0.0f),
                                               ImVec2(0.80901694f, -0.5877853f),
                                               ImVec2(0.80901694f, -0.5877853f),
                                               ImVec2(1.0f, 0.0f)};
+static const ImVec2 MARKER_LINE_HEXAGON[12] = {ImVec2(1, 0),            ImVec2(0.5f, SQRT_3_2),   ImVec2(0.5f, SQRT_3_2),
+                                               ImVec2(-0.5f, SQRT_3_2), ImVec2(-0.5f, SQRT_3_2),  ImVec2(-1, 0),
+                                               ImVec2(-1, 0),           ImVec2(-0.5f, -SQRT_3_2), ImVec2(-0.5f, -SQRT_3_2),
+                                               ImVec2(0.5f, -SQRT_3_2), ImVec2(0.5f, -SQRT_3_2),  ImVec2(1, 0)};
 static const ImVec2 MARKER_LINE_SQUARE[8] = {ImVec2(SQRT_1_2, SQRT_1_2),   ImVec2(SQRT_1_2, -SQRT_1_2),  ImVec2(SQRT_1_2, -SQRT_1_2),
                                              ImVec2(-SQRT_1_2, -SQRT_1_2), ImVec2(-SQRT_1_2, -SQRT_1_2), ImVec2(-SQRT_1_2, SQRT_1_2),
                                              ImVec2(-SQRT_1_2, SQRT_1_2),  ImVec2(SQRT_1_2, SQRT_1_2)};
@@ -1095,33 +1822,222 @@ static const ImVec2 MARKER_LINE_PLUS[4] = {ImVec2(-1, 0), ImVec2(1, 0), ImVec2(0
 static const ImVec2 MARKER_LINE_CROSS[4] = {ImVec2(-SQRT_1_2, -SQRT_1_2), ImVec2(SQRT_1_2, SQRT_1_2), ImVec2(SQRT_1_2, -SQRT_1_2),
                                             ImVec2(-SQRT_1_2, SQRT_1_2)};
 
-template <typename _Getter> void RenderMarkers(const _Getter& getter, ImPlot3DMarker marker, float size, bool rend_fill, ImU32 col_fill,
-                                               bool rend_line, ImU32 col_line, float weight) {
-    if (rend_fill) {
+// Returns the template used to render #marker, either as a filled polygon (triangle fan) or as an outline (line segments)
+static bool GetMarkerTemplate(ImPlot3DMarker marker, bool outline, const ImVec2** vtx, int* count) {
+#define MARKER_TEMPLATE(arr)                                                                                                                         \
+    do {                                                                                                                                             \
+        *vtx = arr;                                                                                                                                  \
+        *count = IM_ARRAYSIZE(arr);                                                                                                                  \
+        return true;                                                                                                                                 \
+    } while (0)
+    if (!outline) {
         switch (marker) {
-            case ImPlot3DMarker_Circle: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_CIRCLE, 10, size, col_fill); break;
-            case ImPlot3DMarker_Square: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_SQUARE, 4, size, col_fill); break;
-            case ImPlot3DMarker_Diamond: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_DIAMOND, 4, size, col_fill); break;
-            case ImPlot3DMarker_Up: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_UP, 3, size, col_fill); break;
-            case ImPlot3DMarker_Down: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_DOWN, 3, size, col_fill); break;
-            case ImPlot3DMarker_Left: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_LEFT, 3, size, col_fill); break;
-            case ImPlot3DMarker_Right: RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_RIGHT, 3, size, col_fill); break;
+            case ImPlot3DMarker_Circle: MARKER_TEMPLATE(MARKER_FILL_CIRCLE);
+            case ImPlot3DMarker_Square: MARKER_TEMPLATE(MARKER_FILL_SQUARE);
+            case ImPlot3DMarker_Diamond: MARKER_TEMPLATE(MARKER_FILL_DIAMOND);
+            case ImPlot3DMarker_Up: MARKER_TEMPLATE(MARKER_FILL_UP);
+            case ImPlot3DMarker_Down: MARKER_TEMPLATE(MARKER_FILL_DOWN);
+            case ImPlot3DMarker_Left: MARKER_TEMPLATE(MARKER_FILL_LEFT);
+            case ImPlot3DMarker_Right: MARKER_TEMPLATE(MARKER_FILL_RIGHT);
         }
-    }
-    if (rend_line) {
+    } else {
         switch (marker) {
-            case ImPlot3DMarker_Circle: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_CIRCLE, 20, size, weight, col_line); break;
-            case ImPlot3DMarker_Square: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_SQUARE, 8, size, weight, col_line); break;
-            case ImPlot3DMarker_Diamond: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_DIAMOND, 8, size, weight, col_line); break;
-            case ImPlot3DMarker_Up: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_UP, 6, size, weight, col_line); break;
-            case ImPlot3DMarker_Down: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_DOWN, 6, size, weight, col_line); break;
-            case ImPlot3DMarker_Left: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_LEFT, 6, size, weight, col_line); break;
-            case ImPlot3DMarker_Right: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_RIGHT, 6, size, weight, col_line); break;
-            case ImPlot3DMarker_Asterisk: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_ASTERISK, 6, size, weight, col_line); break;
-            case ImPlot3DMarker_Plus: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_PLUS, 4, size, weight, col_line); break;
-            case ImPlot3DMarker_Cross: RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_CROSS, 4, size, weight, col_line); break;
+            case ImPlot3DMarker_Circle: MARKER_TEMPLATE(MARKER_LINE_CIRCLE);
+            case ImPlot3DMarker_Square: MARKER_TEMPLATE(MARKER_LINE_SQUARE);
+            case ImPlot3DMarker_Diamond: MARKER_TEMPLATE(MARKER_LINE_DIAMOND);
+            case ImPlot3DMarker_Up: MARKER_TEMPLATE(MARKER_LINE_UP);
+            case ImPlot3DMarker_Down: MARKER_TEMPLATE(MARKER_LINE_DOWN);
+            case ImPlot3DMarker_Left: MARKER_TEMPLATE(MARKER_LINE_LEFT);
+            case ImPlot3DMarker_Right: MARKER_TEMPLATE(MARKER_LINE_RIGHT);
+            case ImPlot3DMarker_Asterisk: MARKER_TEMPLATE(MARKER_LINE_ASTERISK);
+            case ImPlot3DMarker_Plus: MARKER_TEMPLATE(MARKER_LINE_PLUS);
+            case ImPlot3DMarker_Cross: MARKER_TEMPLATE(MARKER_LINE_CROSS);
+        }
+    }
+#undef MARKER_TEMPLATE
+    return false;
+}
+
+#ifdef IMGUI_HAS_TEXTURES
+static const int MARKER_SPRITE_MAX_COUNT = 64;  // Maximum number of sprites kept in the font atlas
+static const int MARKER_SPRITE_MAX_EXTENT = 96; // Larger markers are rendered with geometry
+
+// Signed distance (in pixels) from #p to the edge of the marker shape centered at the origin
+static float MarkerSpriteDistance(const ImVec2* vtx, int count, ImPlot3DMarker marker, bool outline, float size, float half_weight, ImVec2 p) {
+    if (marker == ImPlot3DMarker_Circle) {
+        // Use the exact circle instead of its polygon approximation
+        float r = ImSqrt(p.x * p.x + p.y * p.y);
+        return outline ? ImAbs(r - size) - half_weight : r - size;
+    }
+    if (!outline) {
+        // Convex polygon, the marker center is always inside
+        float d = -FLT_MAX;
+        for (int i = 0; i < count; i++) {
+            ImVec2 a(vtx[i].x * size, vtx[i].y * size);
+            ImVec2 b(vtx[(i + 1) % count].x * size, vtx[(i + 1) % count].y * size);
+            ImVec2 n(b.y - a.y, a.x - b.x);
+            float len = ImSqrt(n.x * n.x + n.y * n.y);
+            if (len <= 0.0f)
+                continue;
+            float sign = (n.x * -a.x + n.y * -a.y) > 0.0f ? -1.0f : 1.0f;
+            d = ImMax(d, sign * (n.x * (p.x - a.x) + n.y * (p.y - a.y)) / len);
+        }
+        return d;
+    }
+    // Line segments
+    float d = FLT_MAX;
+    for (int i = 0; i + 1 < count; i += 2) {
+        ImVec2 a(vtx[i].x * size, vtx[i].y * size);
+        ImVec2 b(vtx[i + 1].x * size, vtx[i + 1].y * size);
+        ImVec2 closest = ImLineClosestPoint(a, b, p);
+        float dx = p.x - closest.x;
+        float dy = p.y - closest.y;
+        d = ImMin(d, ImSqrt(dx * dx + dy * dy));
+    }
+    return d - half_weight;
+}
+
+// Returns the UVs and half extent (in pixels) of the sprite for the given marker, rendering it into the font atlas if needed
+static bool GetMarkerSprite(ImPlot3DMarker marker, bool outline, float size, float weight, ImVec2* uv0, ImVec2* uv1, float* half_extent) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    ImFontAtlas* atlas = ImGui::GetFont()->ContainerAtlas;
+    if (atlas == nullptr || !atlas->RendererHasTextures || atlas->TexData == nullptr)
+        return false;
+    if (gp.MarkerSpriteAtlas != atlas) {
+        gp.MarkerSprites.clear();
+        gp.MarkerSpriteAtlas = atlas;
+    }
+
+    // Quantize the size and weight so that small animations don't fill the atlas
+    size = ImFloor(size * 4.0f + 0.5f) / 4.0f;
+    weight = outline ? ImFloor(ImMax(1.0f, weight) * 4.0f + 0.5f) / 4.0f : 0.0f;
+    const float half_weight = weight * 0.5f;
+    const int extent = (int)ImCeil(2.0f * (size + half_weight + 1.0f));
+    if (size <= 0.0f || extent > MARKER_SPRITE_MAX_EXTENT)
+        return false;
+
+    // Look for a cached sprite that is still valid
+    ImPlot3DMarkerSprite* sprite = nullptr;
+    for (int i = 0; i < gp.MarkerSprites.Size; i++) {
+        ImPlot3DMarkerSprite& s = gp.MarkerSprites[i];
+        if (s.Marker == marker && s.Outline == outline && s.Size == size && s.Weight == weight) {
+            sprite = &s;
+            break;
+        }
+    }
+    ImFontAtlasRect rect;
+    const int frame = ImGui::GetFrameCount();
+    if (sprite != nullptr && atlas->GetCustomRect(sprite->RectId, &rect)) {
+        sprite->LastFrameUsed = frame;
+        *uv0 = rect.uv0;
+        *uv1 = rect.uv1;
+        *half_extent = extent * 0.5f;
+        return true;
+    }
+
+    // Render the sprite (the atlas was rebuilt or the sprite doesn't exist yet)
+    const ImVec2* vtx;
+    int count;
+    if (!GetMarkerTemplate(marker, outline, &vtx, &count))
+        return false;
+    if (sprite == nullptr && gp.MarkerSprites.Size >= MARKER_SPRITE_MAX_COUNT) {
+        // Evict the least recently used sprite and reuse its slot. Sprites drawn this frame are kept since their UVs are already in the draw list
+        ImPlot3DMarkerSprite* lru = &gp.MarkerSprites[0];
+        for (int i = 1; i < gp.MarkerSprites.Size; i++)
+            if (gp.MarkerSprites[i].LastFrameUsed < lru->LastFrameUsed)
+                lru = &gp.MarkerSprites[i];
+        if (lru->LastFrameUsed == frame)
+            return false;
+        ImFontAtlasRect lru_rect;
+        if (atlas->GetCustomRect(lru->RectId, &lru_rect))
+            atlas->RemoveCustomRect(lru->RectId);
+        lru->RectId = ImFontAtlasRectId_Invalid;
+        sprite = lru;
+        sprite->Marker = marker;
+        sprite->Outline = outline;
+        sprite->Size = size;
+        sprite->Weight = weight;
+    }
+    ImFontAtlasRectId rect_id = atlas->AddCustomRect(extent, extent, &rect);
+    if (rect_id == ImFontAtlasRectId_Invalid)
+        return false;
+    ImTextureData* tex = atlas->TexData;
+    const float center = extent * 0.5f;
+    for (int y = 0; y < extent; y++) {
+        for (int x = 0; x < extent; x++) {
+            // Antialias with the distance to the shape edge, sampled at the pixel center
+            ImVec2 p(x + 0.5f - center, y + 0.5f - center);
+            float d = MarkerSpriteDistance(vtx, count, marker, outline, size, half_weight, p);
+            unsigned char a = (unsigned char)(ImClamp(0.5f - d, 0.0f, 1.0f) * 255.0f + 0.5f);
+            if (tex->Format == ImTextureFormat_Alpha8)
+                *(unsigned char*)tex->GetPixelsAt(rect.x + x, rect.y + y) = a;
+            else
+                *(ImU32*)tex->GetPixelsAt(rect.x + x, rect.y + y) = IM_COL32(255, 255, 255, a);
         }
     }
+    ImFontAtlasTextureBlockQueueUpload(atlas, tex, rect.x, rect.y, rect.w, rect.h);
+
+    if (sprite == nullptr) {
+        gp.MarkerSprites.push_back(ImPlot3DMarkerSprite());
+        sprite = &gp.MarkerSprites.back();
+        sprite->Marker = marker;
+        sprite->Outline = outline;
+        sprite->Size = size;
+        sprite->Weight = weight;
+    }
+    sprite->RectId = rect_id;
+    sprite->LastFrameUsed = frame;
+    *uv0 = rect.uv0;
+    *uv1 = rect.uv1;
+    *half_extent = center;
+    return true;
+}
+#endif
+
+template <typename _Getter> void RenderMarkers(const _Getter& getter, ImPlot3DMarker marker, float size, bool rend_fill, ImU32 col_fill,
+                                               bool rend_line, ImU32 col_line, float weight) {
+#ifdef IMGUI_HAS_TEXTURES
+    // Sprite markers: one textured quad per marker instead of the polygon/outline geometry
+    if (ImHasFlag(GetItemData().Spec.Flags, ImPlot3DItemFlags_SpriteMarkers)) {
+        ImVec2 uv0, uv1;
+        float half_extent;
+        if (rend_fill && GetMarkerSprite(marker, false, size, 0.0f, &uv0, &uv1, &half_extent)) {
+            RenderPrimitives<RendererMarkersSprite>(getter, uv0, uv1, half_extent, col_fill);
+            rend_fill = false;
+        }
+        if (rend_line && GetMarkerSprite(marker, true, size, weight, &uv0, &uv1, &half_extent)) {
+            RenderPrimitives<RendererMarkersSprite>(getter, uv0, uv1, half_extent, col_line);
+            rend_line = false;
+        }
+    }
+#endif
+    if (!rend_fill && !rend_line)
+        return;
+
+    // Markers only a few pixels wide are drawn as a single filled square covering the outline too, since a sub-pixel outline is not visible. The
+    // square takes the fill color if the marker is filled. Line-only markers (e.g. crosses) keep their shape, as a square would look different
+    const ImVec2* vtx;
+    int count;
+    const bool fillable = GetMarkerTemplate(marker, false, &vtx, &count);
+    if (size <= MARKER_LOD_SQUARE_SIZE && fillable) {
+        float extent = rend_line ? size + ImMax(1.0f, weight) * 0.5f : size;
+        RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_SQUARE, 4, extent, rend_fill ? col_fill : col_line);
+        return;
+    }
+
+    if (rend_fill && fillable) {
+        // Small circles are indistinguishable from hexagons
+        if (marker == ImPlot3DMarker_Circle && size <= MARKER_LOD_HEXAGON_SIZE)
+            RenderPrimitives<RendererMarkersFill>(getter, MARKER_FILL_HEXAGON, 6, size, col_fill);
+        else
+            RenderPrimitives<RendererMarkersFill>(getter, vtx, count, size, col_fill);
+    }
+    if (rend_line && GetMarkerTemplate(marker, true, &vtx, &count)) {
+        if (marker == ImPlot3DMarker_Circle && size <= MARKER_LOD_HEXAGON_SIZE)
+            RenderPrimitives<RendererMarkersLine>(getter, MARKER_LINE_HEXAGON, 12, size, weight, col_line);
+        else
+            RenderPrimitives<RendererMarkersLine>(getter, vtx, count, size, weight, col_line);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1135,8 +2051,9 @@ template <typename Getter> void PlotScatterEx(const char* label_id, const Getter
         ImPlot3DMarker marker = s.Marker == ImPlot3DMarker_None ? ImPlot3DMarker_Circle : s.Marker;
         const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
         const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
+        GetterScaled<Getter> getter_scaled(getter, GetScaledPoints(getter), GetLODStride(getter.Count, true, false));
         if (marker != ImPlot3DMarker_None)
-            RenderMarkers<Getter>(getter, marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+            RenderMarkers(getter_scaled, marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
         EndItem();
     }
 }
@@ -1160,25 +2077,34 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlot3DSpec& spec) {
+// Renders the line colored per vertex by #vtx_cols if provided, or by #values colormapped from #scale_min to #scale_max if provided
+template <typename _Getter, typename _Indexer>
+void PlotLineEx(const char* label_id, const _Getter& getter, const _Indexer* values, double scale_min, double scale_max, const ImU32* vtx_cols,
+                const ImPlot3DSpec& spec) {
     if (BeginItemEx(label_id, getter, spec, spec.LineColor, spec.Marker)) {
         const ImPlot3DNextItemData& n = GetItemData();
         const ImPlot3DSpec& s = n.Spec;
+        const int lod_stride = n.RenderLine ? GetLODStride(2 * getter.Count, false, false) : GetLODStride(getter.Count, true, false);
+        const int lod_group_size = ImHasFlag(spec.Flags, ImPlot3DLineFlags_Segments) ? 2 : 1;
+        GetterScaled<_Getter> getter_scaled(getter, GetScaledPoints(getter), lod_stride, lod_group_size);
 
-        if (getter.Count >= 2 && n.RenderLine) {
+        if (getter_scaled.Count >= 2 && n.RenderLine) {
             const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
+            if (values != nullptr)
+                vtx_cols = ColormapVertices(*values, getter.Count, scale_min, scale_max, s.LineColor.w);
             if (ImHasFlag(spec.Flags, ImPlot3DLineFlags_Segments)) {
-                RenderPrimitives<RendererLineSegments>(getter, col_line, s.LineWeight);
+                RenderPrimitives<RendererLineSegments>(getter_scaled, col_line, s.LineWeight, vtx_cols);
             } else if (ImHasFlag(spec.Flags, ImPlot3DLineFlags_Loop)) {
+                GetterLoop<GetterScaled<_Getter>> getter_loop(getter_scaled);
                 if (ImHasFlag(spec.Flags, ImPlot3DLineFlags_SkipNaN))
-                    RenderPrimitives<RendererLineStripSkip>(GetterLoop<_Getter>(getter), col_line, s.LineWeight);
+                    RenderPrimitives<RendererLineStripSkip>(getter_loop, col_line, s.LineWeight, vtx_cols);
                 else
-                    RenderPrimitives<RendererLineStrip>(GetterLoop<_Getter>(getter), col_line, s.LineWeight);
+                    RenderPrimitives<RendererLineStrip>(getter_loop, col_line, s.LineWeight, vtx_cols);
             } else {
                 if (ImHasFlag(spec.Flags, ImPlot3DLineFlags_SkipNaN))
-                    RenderPrimitives<RendererLineStripSkip>(getter, col_line, s.LineWeight);
+                    RenderPrimitives<RendererLineStripSkip>(getter_scaled, col_line, s.LineWeight, vtx_cols);
                 else
-                    RenderPrimitives<RendererLineStrip>(getter, col_line, s.LineWeight);
+                    RenderPrimitives<RendererLineStrip>(getter_scaled, col_line, s.LineWeight, vtx_cols);
             }
         }
 
@@ -1186,7 +2112,7 @@ template <typename _Getter> void PlotLineEx(const char* label_id, const _Getter&
         if (s.Marker != ImPlot3DMarker_None) {
             const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
             const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+            RenderMarkers(getter_scaled, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
         }
         EndItem();
     }
@@ -1199,11 +2125,45 @@ IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const
     GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(ys, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(zs, count, spec.Offset, stride), count);
-    return PlotLineEx(label_id, getter, spec);
+    return PlotLineEx(label_id, getter, (const IndexerIdx<T>*)nullptr, 0.0, 0.0, nullptr, spec);
+}
+
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min,
+                           double scale_max, const ImPlot3DSpec& spec) {
+    if (count < 2)
+        return;
+    int stride = Stride<T>(spec);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(ys, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(zs, count, spec.Offset, stride), count);
+    IndexerIdx<T> indexer(values, count, spec.Offset, stride);
+    return PlotLineEx(label_id, getter, &indexer, scale_min, scale_max, nullptr, spec);
+}
+
+IMPLOT3D_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImU32* colors, const ImPlot3DSpec& spec) {
+    if (count < 2)
+        return;
+    int stride = Stride<T>(spec);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(ys, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(zs, count, spec.Offset, stride), count);
+    // The colors follow the offset of the coordinates, but not their stride (which is in bytes of T)
+    const int offset = ImPosMod(spec.Offset, count);
+    if (colors != nullptr && offset != 0) {
+        ImU32* cols = (ImU32*)FrameAlloc(sizeof(ImU32) * count);
+        memcpy(cols, colors + offset, sizeof(ImU32) * (count - offset));
+        memcpy(cols + count - offset, colors, sizeof(ImU32) * offset);
+        colors = cols;
+    }
+    return PlotLineEx(label_id, getter, (const IndexerIdx<T>*)nullptr, 0.0, 0.0, colors, spec);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
-    template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec);
+    template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec);        \
+    template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,                  \
+                                           double scale_min, double scale_max, const ImPlot3DSpec& spec);                                            \
+    template IMPLOT3D_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImU32* colors,              \
+                                           const ImPlot3DSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1211,28 +2171,32 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotTriangle
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotTriangleEx(const char* label_id, const _Getter& getter, const ImPlot3DSpec& spec) {
+template <typename _Getter, typename _Indexer>
+void PlotTriangleEx(const char* label_id, const _Getter& getter, const _Indexer* values, double scale_min, double scale_max,
+                    const ImPlot3DSpec& spec) {
     if (BeginItemEx(label_id, getter, spec, spec.FillColor, spec.Marker)) {
         const ImPlot3DNextItemData& n = GetItemData();
         const ImPlot3DSpec& s = n.Spec;
+        GetterScaled<_Getter> getter_scaled(getter, GetScaledPoints(getter), GetLODStride(getter.Count / 3, false, false), 3);
 
         // Render fill
         if (getter.Count >= 3 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DTriangleFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(s.FillColor);
-            RenderPrimitives<RendererTriangleFill>(getter, col_fill);
+            const ImU32* vtx_cols = values != nullptr ? ColormapVertices(*values, getter.Count, scale_min, scale_max, s.FillAlpha) : nullptr;
+            RenderPrimitives<RendererTriangleFill>(getter_scaled, col_fill, vtx_cols);
         }
 
         // Render lines
         if (getter.Count >= 2 && n.RenderLine && !ImHasFlag(spec.Flags, ImPlot3DTriangleFlags_NoLines)) {
             const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
-            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<_Getter>(getter), col_line, s.LineWeight);
+            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<GetterScaled<_Getter>>(getter_scaled), col_line, s.LineWeight);
         }
 
         // Render markers
         if (s.Marker != ImPlot3DMarker_None && !ImHasFlag(spec.Flags, ImPlot3DTriangleFlags_NoMarkers)) {
             const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
             const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+            RenderMarkers(getter_scaled, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
         }
 
         EndItem();
@@ -1246,11 +2210,25 @@ IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, c
     GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(ys, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(zs, count, spec.Offset, stride), count);
-    return PlotTriangleEx(label_id, getter, spec);
+    return PlotTriangleEx(label_id, getter, (const IndexerIdx<T>*)nullptr, 0.0, 0.0, spec);
+}
+
+IMPLOT3D_TMP void PlotTriangle(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count, double scale_min,
+                               double scale_max, const ImPlot3DSpec& spec) {
+    if (count < 3)
+        return;
+    int stride = Stride<T>(spec);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(ys, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(zs, count, spec.Offset, stride), count);
+    IndexerIdx<T> indexer(values, count, spec.Offset, stride);
+    return PlotTriangleEx(label_id, getter, &indexer, scale_min, scale_max, spec);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
-    template IMPLOT3D_API void PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec);
+    template IMPLOT3D_API void PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, const ImPlot3DSpec& spec);   \
+    template IMPLOT3D_API void PlotTriangle<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int count,              \
+                                               double scale_min, double scale_max, const ImPlot3DSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1262,24 +2240,25 @@ template <typename _Getter> void PlotQuadEx(const char* label_id, const _Getter&
     if (BeginItemEx(label_id, getter, spec, spec.FillColor, spec.Marker)) {
         const ImPlot3DNextItemData& n = GetItemData();
         const ImPlot3DSpec& s = n.Spec;
+        GetterScaled<_Getter> getter_scaled(getter, GetScaledPoints(getter), GetLODStride(getter.Count / 2, false, false), 4);
 
         // Render fill
         if (getter.Count >= 4 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DQuadFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(s.FillColor);
-            RenderPrimitives<RendererQuadFill>(getter, col_fill);
+            RenderPrimitives<RendererQuadFill>(getter_scaled, col_fill);
         }
 
         // Render lines
         if (getter.Count >= 2 && n.RenderLine && !ImHasFlag(spec.Flags, ImPlot3DQuadFlags_NoLines)) {
             const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
-            RenderPrimitives<RendererLineSegments>(GetterQuadLines<_Getter>(getter), col_line, s.LineWeight);
+            RenderPrimitives<RendererLineSegments>(GetterQuadLines<GetterScaled<_Getter>>(getter_scaled), col_line, s.LineWeight);
         }
 
         // Render markers
         if (s.Marker != ImPlot3DMarker_None && !ImHasFlag(spec.Flags, ImPlot3DQuadFlags_NoMarkers)) {
             const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
             const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+            RenderMarkers(getter_scaled, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
         }
 
         EndItem();
@@ -1305,50 +2284,376 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotSurface
 //-----------------------------------------------------------------------------
 
-template <typename _Getter> void PlotSurfaceEx(const char* label_id, const _Getter& getter, int x_count, int y_count, double scale_min,
-                                               double scale_max, const ImPlot3DSpec& spec) {
+// Renders the surface of #getter, with the fill colormapped by #values if #colormapped or if the fill color is automatic
+template <typename _Getter, typename _Indexer>
+void PlotSurfaceEx(const char* label_id, const _Getter& getter, const _Indexer& values, bool colormapped, int x_count, int y_count, double scale_min,
+                   double scale_max, const ImPlot3DSpec& spec) {
     if (BeginItemEx(label_id, getter, spec, spec.FillColor, spec.Marker)) {
         const ImPlot3DNextItemData& n = GetItemData();
         const ImPlot3DSpec& s = n.Spec;
+        const ImPlot3DPoint* scaled_points = GetScaledPoints(getter);
+        // Sample every lod_stride rows and columns while interacting, keeping at least one cell
+        int lod_stride = GetLODStride(2 * ImMax(x_count - 1, 0) * ImMax(y_count - 1, 0), false, true);
+        lod_stride = ImMin(lod_stride, ImMax(1, ImMin(x_count, y_count) - 1));
+        GetterScaled<_Getter> getter_scaled(getter, scaled_points, lod_stride, 1, x_count);
+        x_count = (x_count - 1) / lod_stride + 1;
+        y_count = (y_count - 1) / lod_stride + 1;
 
         // Render fill
         if (getter.Count >= 4 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DSurfaceFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(s.FillColor);
-            RenderPrimitives<RendererSurfaceFill>(getter, x_count, y_count, col_fill, scale_min, scale_max);
+            const ImU32* vtx_cols = colormapped || n.IsAutoFill ? ColormapVertices(values, getter.Count, scale_min, scale_max, s.FillAlpha) : nullptr;
+            RenderPrimitives<RendererSurfaceFill>(getter_scaled, x_count, y_count, col_fill, vtx_cols);
         }
 
         // Render lines
         if (getter.Count >= 2 && n.RenderLine && !ImHasFlag(spec.Flags, ImPlot3DSurfaceFlags_NoLines)) {
             const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
-            RenderPrimitives<RendererLineSegments>(GetterSurfaceLines<_Getter>(getter, x_count, y_count), col_line, s.LineWeight);
+            GetterSurfaceLines<GetterScaled<_Getter>> getter_lines(getter_scaled, x_count, y_count);
+            RenderPrimitives<RendererLineSegments>(getter_lines, col_line, s.LineWeight);
         }
 
         // Render markers
         if (s.Marker != ImPlot3DMarker_None && !ImHasFlag(spec.Flags, ImPlot3DSurfaceFlags_NoMarkers)) {
             const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
             const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+            RenderMarkers(getter_scaled, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
         }
 
         EndItem();
     }
 }
 
-IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min,
-                              double scale_max, const ImPlot3DSpec& spec) {
+// Plots the surface with the fill colormapped by #values, or by #zs if #values is nullptr and the fill color is automatic
+template <typename T>
+void PlotSurfaceValues(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count, int y_count, double scale_min,
+                       double scale_max, const ImPlot3DSpec& spec) {
     int count = x_count * y_count;
     if (count < 4)
         return;
     int stride = Stride<T>(spec);
+    const bool colormapped = values != nullptr;
+    if (!colormapped)
+        values = zs;
+    if (ImHasFlag(spec.Flags, ImPlot3DSurfaceFlags_RowOffset)) {
+        GetterXYZ<IndexerRows<T>, IndexerRows<T>, IndexerRows<T>> getter(IndexerRows<T>(xs, x_count, y_count, spec.Offset, stride),
+                                                                         IndexerRows<T>(ys, x_count, y_count, spec.Offset, stride),
+                                                                         IndexerRows<T>(zs, x_count, y_count, spec.Offset, stride), count);
+        IndexerRows<T> indexer(values, x_count, y_count, spec.Offset, stride);
+        return PlotSurfaceEx(label_id, getter, indexer, colormapped, x_count, y_count, scale_min, scale_max, spec);
+    }
     GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(ys, count, spec.Offset, stride),
                                                                   IndexerIdx<T>(zs, count, spec.Offset, stride), count);
-    return PlotSurfaceEx(label_id, getter, x_count, y_count, scale_min, scale_max, spec);
+    IndexerIdx<T> indexer(values, count, spec.Offset, stride);
+    return PlotSurfaceEx(label_id, getter, indexer, colormapped, x_count, y_count, scale_min, scale_max, spec);
+}
+
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count, double scale_min,
+                              double scale_max, const ImPlot3DSpec& spec) {
+    PlotSurfaceValues(label_id, xs, ys, zs, (const T*)nullptr, x_count, y_count, scale_min, scale_max, spec);
+}
+
+IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count, int y_count,
+                              double scale_min, double scale_max, const ImPlot3DSpec& spec) {
+    IM_ASSERT_USER_ERROR(values != nullptr, "PlotSurface() needs per-vertex values to colormap!");
+    PlotSurfaceValues(label_id, xs, ys, zs, values, x_count, y_count, scale_min, scale_max, spec);
 }
 
 #define INSTANTIATE_MACRO(T)                                                                                                                         \
     template IMPLOT3D_API void PlotSurface<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int x_count, int y_count,                 \
-                                              double scale_min, double scale_max, const ImPlot3DSpec& spec);
+                                              double scale_min, double scale_max, const ImPlot3DSpec& spec);                                         \
+    template IMPLOT3D_API void PlotSurface<T>(const char* label_id, const T* xs, const T* ys, const T* zs, const T* values, int x_count,             \
+                                              int y_count, double scale_min, double scale_max, const ImPlot3DSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotWaterfall
+//-----------------------------------------------------------------------------
+
+// Appends a row to the waterfall ring, overwriting the oldest row once the ring is full
+template <typename _Indexer> void WaterfallPushRow(ImPlot3DWaterfall& wf, const _Indexer& row) {
+    const int slot = wf.RowHead;
+    double* values = &wf.Values[slot * wf.BinCount];
+    double row_min = HUGE_VAL;
+    double row_max = -HUGE_VAL;
+    for (int i = 0; i < wf.BinCount; i++) {
+        values[i] = row(i);
+        if (!ImNanOrInf(values[i])) {
+            row_min = ImMin(row_min, values[i]);
+            row_max = ImMax(row_max, values[i]);
+        }
+    }
+    wf.RowMin[slot] = row_min;
+    wf.RowMax[slot] = row_max;
+    wf.RowProjected[slot] = false;
+    wf.RowColored[slot] = false;
+    wf.RowHead = (wf.RowHead + 1) % wf.RowCapacity;
+    wf.RowCount = ImMin(wf.RowCount + 1, wf.RowCapacity);
+    wf.Version++;
+}
+
+// Returns true if any state used by PlotToPixels changed since the cached projections were computed
+static bool WaterfallViewChanged(ImPlot3DWaterfall& wf, const ImPlot3DPlot& plot) {
+    bool changed = wf.ViewRotation != plot.Rotation || wf.ViewRect.Min != plot.PlotRect.Min || wf.ViewRect.Max != plot.PlotRect.Max ||
+                   wf.ViewScale != plot.GetViewScale();
+    for (int i = 0; i < 3; i++) {
+        const ImPlot3DAxis& axis = plot.Axes[i];
+        changed |= wf.ViewRanges[i].Min != axis.Range.Min || wf.ViewRanges[i].Max != axis.Range.Max || wf.ViewNDCScales[i] != axis.NDCScale ||
+                   wf.ViewFlags[i] != axis.Flags || wf.ViewTransforms[i] != axis.TransformForward || wf.ViewTransformData[i] != axis.TransformData;
+    }
+    if (changed) {
+        wf.ViewRotation = plot.Rotation;
+        wf.ViewRect = plot.PlotRect;
+        wf.ViewScale = plot.GetViewScale();
+        for (int i = 0; i < 3; i++) {
+            const ImPlot3DAxis& axis = plot.Axes[i];
+            wf.ViewRanges[i] = axis.Range;
+            wf.ViewNDCScales[i] = axis.NDCScale;
+            wf.ViewFlags[i] = axis.Flags;
+            wf.ViewTransforms[i] = axis.TransformForward;
+            wf.ViewTransformData[i] = axis.TransformData;
+        }
+    }
+    return changed;
+}
+
+// Projects the rows that are not cached yet and computes the per-frame shift of each row.
+// With a linear Y axis, moving a row along Y shifts all of its pixels and depths by the same amount, so rows are projected once at Y = 0 and
+// only shifted while they scroll. Non-linear Y axes fall back to projecting every row at its actual position each frame.
+static void WaterfallUpdateProjections(ImPlot3DWaterfall& wf, double row_step) {
+    ImPlot3DPlot& plot = *GetCurrentPlot();
+    const bool linear_y = plot.Axes[ImAxis3D_Y].TransformForward == nullptr;
+    if (WaterfallViewChanged(wf, plot) || !linear_y)
+        wf.InvalidateProjections();
+
+    // Shift of a row per unit of Y, from the projection of the Y axis alone (see ModelProjection). Projecting a reference point instead would
+    // depend on the X and Z scales, and x = 0 or z = 0 isn't valid on log axes
+    const ImPlot3DAxis& axis_y = plot.Axes[ImAxis3D_Y];
+    const double sign_y = ImHasFlag(axis_y.Flags, ImPlot3DAxisFlags_Invert) ? -1.0 : 1.0;
+    const double ndc_scale_y = sign_y * axis_y.NDCScale / (axis_y.Range.Max - axis_y.Range.Min);
+    const ImPlot3DPoint rot_y = plot.Rotation * ImPlot3DPoint(0.0, 1.0, 0.0);
+    const double view_scale = plot.GetViewScale();
+    const ImVec2 pix_per_y((float)(view_scale * rot_y.x * ndc_scale_y), (float)(-view_scale * rot_y.y * ndc_scale_y));
+    const double depth_per_y = sign_y * rot_y.z;
+    for (int age = 0; age < wf.RowCount; age++) {
+        const double y = age * row_step;
+        const int slot = wf.GetSlot(age);
+        if (!wf.RowProjected[slot]) {
+            const double y_proj = linear_y ? 0.0 : y;
+            for (int i = 0; i < wf.BinCount; i++) {
+                ImPlot3DPoint p(wf.Xs[i], y_proj, wf.Values[slot * wf.BinCount + i]);
+                wf.PixPos[slot * wf.BinCount + i] = PlotToPixels(p);
+                wf.PixDepth[slot * wf.BinCount + i] = GetPointDepth(p);
+            }
+            wf.RowProjected[slot] = true;
+        }
+        if (linear_y) {
+            wf.RowPixShift[age] = pix_per_y * (float)y;
+            wf.RowZShift[age] = depth_per_y * y;
+        } else {
+            wf.RowPixShift[age] = ImVec2(0.0f, 0.0f);
+            wf.RowZShift[age] = 0.0;
+        }
+    }
+}
+
+// Computes the colormap colors of the rows that are not cached yet
+static void WaterfallUpdateColors(ImPlot3DWaterfall& wf, double scale_min, double scale_max) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    double min = scale_min;
+    double max = scale_max;
+    if (scale_min == 0.0 && scale_max == 0.0) {
+        min = HUGE_VAL;
+        max = -HUGE_VAL;
+        for (int age = 0; age < wf.RowCount; age++) {
+            min = ImMin(min, wf.RowMin[wf.GetSlot(age)]);
+            max = ImMax(max, wf.RowMax[wf.GetSlot(age)]);
+        }
+    }
+    const float alpha = gp.NextItemData.Spec.FillAlpha;
+    if (wf.ColorMap != gp.Style.Colormap || wf.ColorMin != min || wf.ColorMax != max || wf.ColorAlpha != alpha) {
+        wf.ColorMap = gp.Style.Colormap;
+        wf.ColorMin = min;
+        wf.ColorMax = max;
+        wf.ColorAlpha = alpha;
+        wf.InvalidateColors();
+    }
+
+    for (int age = 0; age < wf.RowCount; age++) {
+        const int slot = wf.GetSlot(age);
+        if (wf.RowColored[slot])
+            continue;
+        for (int i = 0; i < wf.BinCount; i++) {
+            ImVec4 col = SampleColormap((float)ImClamp(ImRemap01(wf.Values[slot * wf.BinCount + i], min, max), 0.0, 1.0));
+            col.w *= alpha;
+            wf.Colors[slot * wf.BinCount + i] = ImGui::ColorConvertFloat4ToU32(col);
+        }
+        wf.RowColored[slot] = true;
+    }
+}
+
+static void PlotWaterfallEx(const char* label_id, ImPlot3DWaterfall& wf, double row_step, double scale_min, double scale_max,
+                            const ImPlot3DSpec& spec) {
+    GetterWaterfall getter(wf, row_step);
+    if (BeginItemEx(label_id, getter, spec, spec.FillColor, spec.Marker)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+        const ImPlot3DSpec& s = n.Spec;
+
+        const bool render_fill = wf.RowCount >= 2 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DWaterfallFlags_NoFill);
+        const bool render_lines = wf.RowCount >= 1 && n.RenderLine && !ImHasFlag(spec.Flags, ImPlot3DWaterfallFlags_NoLines);
+        if (render_fill || render_lines)
+            WaterfallUpdateProjections(wf, row_step);
+
+        // Render fill
+        if (render_fill) {
+            const ImU32 col_fill = ImGui::GetColorU32(s.FillColor);
+            if (n.IsAutoFill)
+                WaterfallUpdateColors(wf, scale_min, scale_max);
+            RenderPrimitives<RendererWaterfallFill>(getter, col_fill, n.IsAutoFill);
+        }
+
+        // Render lines
+        if (render_lines) {
+            const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
+            RenderPrimitives<RendererWaterfallLines>(getter, col_line, s.LineWeight);
+        }
+
+        // Render markers
+        if (s.Marker != ImPlot3DMarker_None && !ImHasFlag(spec.Flags, ImPlot3DWaterfallFlags_NoMarkers)) {
+            const ImU32 col_line = ImGui::GetColorU32(s.MarkerLineColor);
+            const ImU32 col_fill = ImGui::GetColorU32(s.MarkerFillColor);
+            RenderMarkers(getter, s.Marker, s.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, s.LineWeight);
+        }
+
+        EndItem();
+    }
+}
+
+IMPLOT3D_TMP void PlotWaterfall(const char* label_id, const T* values, int count, int max_rows, double x_min, double x_max, double row_step,
+                                double scale_min, double scale_max, const ImPlot3DSpec& spec) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotWaterfall() needs to be called between BeginPlot() and EndPlot()!");
+    if (count < 2 || max_rows < 1)
+        return;
+
+    // The rows are owned by the item group, so the history is kept while the item is hidden
+    ImPlot3DItemGroup& items = *gp.CurrentItems;
+    ImPlot3DWaterfall& wf = *items.GetOrAddWaterfall(items.GetItemID(label_id));
+    if (wf.BinCount != count || wf.RowCapacity != max_rows)
+        wf.Reset(count, max_rows);
+    if (wf.XMin != x_min || wf.XMax != x_max) {
+        wf.XMin = x_min;
+        wf.XMax = x_max;
+        for (int i = 0; i < count; i++)
+            wf.Xs[i] = x_min + (x_max - x_min) * i / (count - 1);
+        wf.InvalidateProjections();
+        wf.Version++;
+    }
+    if (wf.RowStep != row_step) {
+        wf.RowStep = row_step;
+        wf.Version++;
+    }
+    if (values != nullptr)
+        WaterfallPushRow(wf, IndexerIdx<T>(values, count, spec.Offset, Stride<T>(spec)));
+
+    // The rows are owned by the waterfall, so its own version replaces the one of the caller (which doesn't change when a row is pushed). Items
+    // without a data version are still treated as changing every frame
+    if (spec.DataVersion < 0) {
+        PlotWaterfallEx(label_id, wf, row_step, scale_min, scale_max, spec);
+        return;
+    }
+    ImPlot3DSpec spec_wf = spec;
+    spec_wf.DataVersion = (int)(wf.Version & 0x7FFFFFFF);
+    PlotWaterfallEx(label_id, wf, row_step, scale_min, scale_max, spec_wf);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotWaterfall<T>(const char* label_id, const T* values, int count, int max_rows, double x_min, double x_max,         \
+                                                double row_step, double scale_min, double scale_max, const ImPlot3DSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotHeatmap3D
+//-----------------------------------------------------------------------------
+
+IMPLOT3D_TMP void PlotHeatmap3D(const char* label_id, const T* values, int rows, int cols, const ImPlot3DPoint& center, const ImPlot3DPoint& axis_u,
+                                const ImPlot3DPoint& axis_v, double scale_min, double scale_max, int data_version, const ImPlot3DSpec& spec) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotHeatmap3D() needs to be called between BeginPlot() and EndPlot()!");
+    if (rows < 1 || cols < 1)
+        return;
+
+    ImPlot3DPoint corners[4] = {center - axis_u - axis_v, center + axis_u - axis_v, center + axis_u + axis_v, center - axis_u + axis_v};
+    Getter3DPoints getter(corners, 4);
+    if (!BeginItemEx(label_id, getter, spec, spec.FillColor))
+        return;
+    const ImPlot3DNextItemData& n = GetItemData();
+    ImPlot3DItemGroup& items = *gp.CurrentItems;
+    ImPlot3DHeatmap& hm = *items.GetOrAddHeatmap(GetCurrentItem()->ID);
+
+    // Colormap the values again only if any of the inputs changed
+    const int count = rows * cols;
+    IndexerIdx<T> indexer(values, count, spec.Offset, Stride<T>(spec));
+    bool dirty = data_version < 0 || hm.DataVersion != data_version || hm.Data != values || hm.Rows != rows || hm.Cols != cols ||
+                 hm.ScaleMin != scale_min || hm.ScaleMax != scale_max || hm.Colormap != gp.Style.Colormap || hm.Alpha != n.Spec.FillAlpha;
+    hm.Data = values;
+    hm.Rows = rows;
+    hm.Cols = cols;
+    hm.DataVersion = data_version;
+    hm.ScaleMin = scale_min;
+    hm.ScaleMax = scale_max;
+    hm.Colormap = gp.Style.Colormap;
+    hm.Alpha = n.Spec.FillAlpha;
+
+    double min = scale_min;
+    double max = scale_max;
+    if (dirty && scale_min == 0.0 && scale_max == 0.0)
+        GetValuesRange(indexer, count, min, max);
+
+#ifdef IMGUI_HAS_TEXTURES
+    // Upload the colormapped values to a dynamic texture and render a single textured quad
+    if (hm.Texture == nullptr || hm.Texture->Width != cols || hm.Texture->Height != rows) {
+        DestroyItemTexture(hm.Texture);
+        hm.Texture = IM_NEW(ImTextureData)();
+        hm.Texture->Create(ImTextureFormat_RGBA32, cols, rows);
+        ImGui::RegisterUserTexture(hm.Texture);
+        dirty = true;
+    }
+    ImTextureData* tex = hm.Texture;
+    if (dirty) {
+        ColormapValues((ImU32*)tex->GetPixels(), indexer, count, min, max, n.Spec.FillAlpha);
+        if (tex->Status == ImTextureStatus_OK) {
+            ImTextureRect rect;
+            rect.x = rect.y = 0;
+            rect.w = (unsigned short)cols;
+            rect.h = (unsigned short)rows;
+            tex->Updates.push_back(rect);
+            tex->UpdateRect = rect;
+            tex->SetStatus(ImTextureStatus_WantUpdates);
+        } else if (tex->Status == ImTextureStatus_Destroyed) {
+            tex->SetStatus(ImTextureStatus_WantCreate);
+        }
+    }
+    RenderPrimitives<RendererQuadImage>(getter, tex->GetTexRef(), ImVec2(0, 0), ImVec2(1, 0), ImVec2(1, 1), ImVec2(0, 1), IM_COL32_WHITE);
+#else
+    // No dynamic textures, render one flat quad per cell
+    if (dirty) {
+        hm.Pixels.resize(count);
+        ColormapValues(hm.Pixels.Data, indexer, count, min, max, n.Spec.FillAlpha);
+    }
+    RenderPrimitives<RendererHeatmapCells>(getter, rows, cols, hm.Pixels.Data);
+#endif
+
+    EndItem();
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotHeatmap3D<T>(const char* label_id, const T* values, int rows, int cols, const ImPlot3DPoint& center,             \
+                                                const ImPlot3DPoint& axis_u, const ImPlot3DPoint& axis_v, double scale_min, double scale_max,    \
+                                                int data_version, const ImPlot3DSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1356,24 +2661,216 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotMesh
 //-----------------------------------------------------------------------------
 
-void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const ImPlot3DSpec& spec) {
-    Getter3DPoints getter(vtx, vtx_count);                     // Get vertices
-    GetterMeshTriangles getter_triangles(vtx, idx, idx_count); // Get triangle vertices
+// Instances of a template mesh. The points are the corners of the box around the bounding sphere of each instance, so fitting and item bounds
+// (see BeginItemEx) account for the whole instances without transforming their vertices
+struct GetterMeshInstances {
+    GetterMeshInstances(const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const ImPlot3DPoint* positions,
+                        const double* scales, const ImPlot3DQuat* rotations, int instance_count)
+        : Vtx(vtx), Idx(idx), VtxCount(vtx_count), IdxCount(idx_count), Positions(positions), Scales(scales), Rotations(rotations),
+          InstanceCount(instance_count), Count(instance_count * 2), SphereCenter(0.0, 0.0, 0.0), SphereRadius(0.0) {
+        if (VtxCount <= 0)
+            return;
+        // Bounding sphere of the template, centered on its bounding box
+        ImPlot3DBox box(Vtx[0], Vtx[0]);
+        for (int i = 1; i < VtxCount; i++)
+            box.Expand(Vtx[i]);
+        SphereCenter = (box.Min + box.Max) * 0.5;
+        double radius_sqr = 0.0;
+        for (int i = 0; i < VtxCount; i++) {
+            const ImPlot3DPoint d = Vtx[i] - SphereCenter;
+            radius_sqr = ImMax(radius_sqr, d.x * d.x + d.y * d.y + d.z * d.z);
+        }
+        SphereRadius = ImSqrt(radius_sqr);
+    }
 
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        const int inst = (int)(idx / 2);
+        const double r = Radius(inst);
+        const ImPlot3DPoint c = Center(inst);
+        return idx % 2 == 0 ? c - ImPlot3DPoint(r, r, r) : c + ImPlot3DPoint(r, r, r);
+    }
+
+    IMPLOT3D_INLINE double Scale(int inst) const { return Scales != nullptr ? Scales[inst] : 1.0; }
+    IMPLOT3D_INLINE ImPlot3DQuat Rotation(int inst) const { return Rotations != nullptr ? Rotations[inst] : ImPlot3DQuat(); }
+    IMPLOT3D_INLINE ImPlot3DPoint Center(int inst) const { return Positions[inst] + Rotation(inst) * (SphereCenter * Scale(inst)); }
+    IMPLOT3D_INLINE double Radius(int inst) const { return SphereRadius * ImAbs(Scale(inst)); }
+
+    const ImPlot3DPoint* Vtx;
+    const unsigned int* Idx;
+    const int VtxCount;
+    const int IdxCount;
+    const ImPlot3DPoint* Positions;
+    const double* Scales;
+    const ImPlot3DQuat* Rotations;
+    const int InstanceCount;
+    const int Count;
+    ImPlot3DPoint SphereCenter; // Bounding sphere of the template mesh
+    double SphereRadius;
+};
+
+// Tests a sphere against #cull_box, to accept or reject a whole instance at once
+static IMPLOT3D_INLINE ItemCull CullSphere(const ImPlot3DBox& cull_box, const ImPlot3DPoint& center, double radius) {
+    bool inside = true;
+    for (int i = 0; i < 3; i++) {
+        if (center[i] + radius < cull_box.Min[i] || center[i] - radius > cull_box.Max[i])
+            return ItemCull_Outside;
+        inside &= center[i] - radius >= cull_box.Min[i] && center[i] + radius <= cull_box.Max[i];
+    }
+    return inside ? ItemCull_Inside : ItemCull_Partial;
+}
+static IMPLOT3D_INLINE ItemCull CullSphere(const NoCullBox&, const ImPlot3DPoint&, double) { return ItemCull_Inside; }
+
+// Renders one instance per primitive. The template vertices are projected once per instance through the fused model and plot projection (see
+// ModelProjection) and shared by its triangles with explicit indices, each triangle keeping its own depth. Instances crossing the culling box
+// have their triangles fully outside of it collapsed to a single point. Each instance is filled with its color in #inst_cols, or each vertex
+// with its color in #vtx_cols, or all of them with #col
+template <class _Getter> struct RendererMeshInstanced : RendererBase {
+    RendererMeshInstanced(const _Getter& getter, ImU32 col, const ImU32* inst_cols, const ImU32* vtx_cols = nullptr)
+        : RendererBase(getter.InstanceCount, getter.IdxCount, getter.VtxCount), Getter(getter), Col(col), InstCols(inst_cols), VtxCols(vtx_cols),
+          Projection(*GetCurrentPlot()) {
+        // Triangle centroids of the template, to compute the depth of the triangles of every instance
+        const int tri_count = Getter.IdxCount / 3;
+        ImPlot3DPoint* tri_vtx = (ImPlot3DPoint*)FrameAlloc(sizeof(ImPlot3DPoint) * 3 * tri_count);
+        for (int i = 0; i < 3 * tri_count; i++)
+            tri_vtx[i] = Getter.Vtx[Getter.Idx[i]];
+        Centroids = (ImPlot3DPoint*)FrameAlloc(sizeof(ImPlot3DPoint) * tri_count);
+        ImPlot3DPoint::Centroids(tri_vtx, 3, Centroids, tri_count);
+        VtxPlot = (ImPlot3DPoint*)FrameAlloc(sizeof(ImPlot3DPoint) * Getter.VtxCount);
+        VtxCulled = (bool*)FrameAlloc(sizeof(bool) * Getter.VtxCount);
+    }
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(0);
+        if (InstCols != nullptr || VtxCols != nullptr)
+            draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        else
+            draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        const ItemCull inst_cull = CullSphere(cull_box, Getter.Center(prim), Getter.Radius(prim));
+        if (inst_cull == ItemCull_Outside)
+            return false;
+        const double scale = Getter.Scale(prim);
+        Projection.SetModel(Getter.Positions[prim], Getter.Rotation(prim), ImPlot3DPoint(scale, scale, scale));
+
+        // 1 vertex per template vertex
+        for (int i = 0; i < Getter.VtxCount; i++)
+            draw_list_3d._PosWritePtr[i] = Projection.ToPixels(Getter.Vtx[i]);
+        draw_list_3d._PosWritePtr += Getter.VtxCount;
+        if (InstCols != nullptr) {
+            for (int i = 0; i < Getter.VtxCount; i++)
+                draw_list_3d._ColWritePtr[i] = InstCols[prim];
+            draw_list_3d._ColWritePtr += Getter.VtxCount;
+        } else if (VtxCols != nullptr) {
+            for (int i = 0; i < Getter.VtxCount; i++)
+                draw_list_3d._ColWritePtr[i] = VtxCols[i];
+            draw_list_3d._ColWritePtr += Getter.VtxCount;
+        }
+
+        // Template indices, offset to the vertices of the instance
+        const unsigned int vtx_idx = draw_list_3d._VtxCurrentIdx;
+        if (inst_cull == ItemCull_Inside) {
+            for (int i = 0; i < Getter.IdxCount; i++)
+                draw_list_3d._IdxWritePtr[i] = (ImDrawIdx)(vtx_idx + Getter.Idx[i]);
+        } else {
+            Projection.ToPlot(Getter.Vtx, VtxPlot, Getter.VtxCount);
+            for (int i = 0; i < Getter.VtxCount; i++)
+                VtxCulled[i] = !cull_box.Contains(VtxPlot[i]);
+            for (int i = 0; i < Getter.IdxCount; i += 3) {
+                const unsigned int* tri = Getter.Idx + i;
+                const bool culled = VtxCulled[tri[0]] && VtxCulled[tri[1]] && VtxCulled[tri[2]];
+                draw_list_3d._IdxWritePtr[i] = (ImDrawIdx)(vtx_idx + tri[0]);
+                draw_list_3d._IdxWritePtr[i + 1] = (ImDrawIdx)(vtx_idx + (culled ? tri[0] : tri[1]));
+                draw_list_3d._IdxWritePtr[i + 2] = (ImDrawIdx)(vtx_idx + (culled ? tri[0] : tri[2]));
+            }
+        }
+        draw_list_3d._IdxWritePtr += Getter.IdxCount;
+
+        // 1 Z per triangle
+        for (int t = 0; t < Getter.IdxCount / 3; t++)
+            draw_list_3d._ZWritePtr[t] = Projection.ToDepth(Centroids[t]);
+        draw_list_3d._ZWritePtr += Getter.IdxCount / 3;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += Getter.VtxCount;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImU32 Col;
+    const ImU32* InstCols;
+    const ImU32* VtxCols;
+    mutable ModelProjection Projection;
+    ImPlot3DPoint* Centroids;
+    ImPlot3DPoint* VtxPlot; // Vertices of the current instance in plot coordinates, when it crosses the culling box
+    bool* VtxCulled;        // Vertices of the current instance outside of the culling box
+};
+
+// Returns #getter reading the triangles of #idx instead (e.g. a decimated index buffer)
+static GetterMeshTriangles WithMeshIndices(const GetterMeshTriangles& getter, const unsigned int* idx, int idx_count) {
+    return GetterMeshTriangles(getter.Vtx, idx, idx_count);
+}
+template <typename _Getter>
+static GetterModel<_Getter> WithMeshIndices(const GetterModel<_Getter>& getter, const unsigned int* idx, int idx_count) {
+    return GetterModel<_Getter>(WithMeshIndices(getter.Getter, idx, idx_count), getter.Model);
+}
+
+// Renders the mesh read through #getter (vertices) and #getter_triangles (3 vertices per triangle), with the fill colormapped by #values if provided,
+// or with the colors of #vtx_cols or #face_cols if provided. With a model transform, the fill is rendered as a single instance of the mesh so its
+// vertices are projected once through the fused model and plot projection, unless its vertices no longer fit in the draw list index range. The
+// triangles are decimated to fit the interactive LOD budget
+template <typename _Getter, typename _GetterTriangles, typename _Indexer>
+void RenderMesh(const char* label_id, const _Getter& getter, const _GetterTriangles& getter_triangles, const ImPlot3DPoint* vtx,
+                const unsigned int* idx, const _Indexer* values, double scale_min, double scale_max, const ImU32* vtx_cols, const ImU32* face_cols,
+                const ImPlot3DSpec& spec) {
     if (BeginItemEx(label_id, getter, spec, spec.FillColor, spec.Marker)) {
         const ImPlot3DNextItemData& n = GetItemData();
         const ImPlot3DSpec& s = n.Spec;
 
+        // Keep one out of every #lod_stride triangles, along with their face colors
+        const int tri_count = getter_triangles.Count / 3;
+        const int lod_stride = GetLODStride(tri_count, false, false);
+        int lod_idx_count = getter_triangles.Count;
+        if (lod_stride > 1) {
+            const int lod_tri_count = (tri_count + lod_stride - 1) / lod_stride;
+            unsigned int* lod_idx = (unsigned int*)FrameAlloc(sizeof(unsigned int) * 3 * lod_tri_count);
+            ImU32* lod_face_cols = face_cols != nullptr ? (ImU32*)FrameAlloc(sizeof(ImU32) * lod_tri_count) : nullptr;
+            for (int t = 0; t < lod_tri_count; t++) {
+                for (int k = 0; k < 3; k++)
+                    lod_idx[3 * t + k] = idx[3 * t * lod_stride + k];
+                if (face_cols != nullptr)
+                    lod_face_cols[t] = face_cols[t * lod_stride];
+            }
+            idx = lod_idx;
+            face_cols = lod_face_cols;
+            lod_idx_count = 3 * lod_tri_count;
+        }
+        const _GetterTriangles getter_lod = lod_stride > 1 ? WithMeshIndices(getter_triangles, idx, lod_idx_count) : getter_triangles;
+
         // Render fill
         if (getter.Count >= 3 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DMeshFlags_NoFill)) {
             const ImU32 col_fill = ImGui::GetColorU32(s.FillColor);
-            RenderPrimitives<RendererTriangleFill>(getter_triangles, col_fill);
+            if (values != nullptr)
+                vtx_cols = ColormapVertices(*values, getter.Count, scale_min, scale_max, s.FillAlpha);
+            // The single instance needs all the mesh vertices in the remaining ImDrawIdx range, otherwise each triangle is transformed on its own
+            const ImDrawList3D& draw_list_3d = GetCurrentPlot()->DrawList;
+            const bool fits = (unsigned int)getter.Count <= ImDrawList3D::MaxIdx() - draw_list_3d._VtxCurrentIdx;
+            if (spec.ModelTransform != nullptr && face_cols == nullptr && fits) {
+                const ImPlot3DModelTransform& model = *spec.ModelTransform;
+                GetterMeshInstances getter_instance(vtx, idx, getter.Count, getter_lod.Count, &model.Translation, &model.Scale, &model.Rotation,
+                                                    1);
+                RenderPrimitives<RendererMeshInstanced>(getter_instance, col_fill, nullptr, vtx_cols);
+            } else {
+                RenderPrimitives<RendererTriangleFill>(getter_lod, col_fill, vtx_cols, face_cols);
+            }
         }
 
         // Render lines
         if (getter.Count >= 2 && n.RenderLine && !n.IsAutoLine && !ImHasFlag(spec.Flags, ImPlot3DMeshFlags_NoLines)) {
             const ImU32 col_line = ImGui::GetColorU32(s.LineColor);
-            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<GetterMeshTriangles>(getter_triangles), col_line, s.LineWeight);
+            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<_GetterTriangles>(getter_lod), col_line, s.LineWeight);
         }
 
         // Render markers
@@ -1387,6 +2884,352 @@ void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int
     }
 }
 
+template <typename _Indexer>
+void PlotMeshEx(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const _Indexer* values,
+                double scale_min, double scale_max, const ImU32* vtx_cols, const ImU32* face_cols, const ImPlot3DSpec& spec) {
+    Getter3DPoints getter(vtx, vtx_count);                     // Get vertices
+    GetterMeshTriangles getter_triangles(vtx, idx, idx_count); // Get triangle vertices
+    if (spec.ModelTransform == nullptr) {
+        RenderMesh(label_id, getter, getter_triangles, vtx, idx, values, scale_min, scale_max, vtx_cols, face_cols, spec);
+        return;
+    }
+
+    // Vertices in model coordinates. Their plot coordinates change with the transform, so they are never cached with the data version
+    ImPlot3DSpec spec_model = spec;
+    spec_model.DataVersion = -1;
+    const ImPlot3DModelTransform& model = *spec.ModelTransform;
+    RenderMesh(label_id, GetterModel<Getter3DPoints>(getter, model), GetterModel<GetterMeshTriangles>(getter_triangles, model), vtx, idx, values,
+               scale_min, scale_max, vtx_cols, face_cols, spec_model);
+}
+
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const ImPlot3DSpec& spec) {
+    PlotMeshEx(label_id, vtx, idx, vtx_count, idx_count, (const IndexerIdx<double>*)nullptr, 0.0, 0.0, nullptr, nullptr, spec);
+}
+
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count, const ImU32* vtx_colors,
+              const ImU32* face_colors, const ImPlot3DSpec& spec) {
+    PlotMeshEx(label_id, vtx, idx, vtx_count, idx_count, (const IndexerIdx<double>*)nullptr, 0.0, 0.0, vtx_colors, face_colors, spec);
+}
+
+IMPLOT3D_TMP void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, const T* values, int vtx_count, int idx_count,
+                           double scale_min, double scale_max, const ImPlot3DSpec& spec) {
+    IndexerIdx<T> indexer(values, vtx_count);
+    PlotMeshEx(label_id, vtx, idx, vtx_count, idx_count, &indexer, scale_min, scale_max, nullptr, nullptr, spec);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotMesh<T>(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, const T* values, int vtx_count,  \
+                                           int idx_count, double scale_min, double scale_max, const ImPlot3DSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+void PlotMeshInstanced(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
+                       const ImPlot3DPoint* positions, const double* scales, const ImPlot3DQuat* rotations, int instance_count, const ImU32* colors,
+                       const ImPlot3DSpec& spec) {
+    GetterMeshInstances getter(vtx, idx, vtx_count, idx_count, positions, scales, rotations, instance_count);
+
+    if (BeginItemEx(label_id, getter, spec, spec.FillColor)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+        if (vtx_count >= 3 && idx_count >= 3 && n.RenderFill && !ImHasFlag(spec.Flags, ImPlot3DMeshFlags_NoFill))
+            RenderPrimitives<RendererMeshInstanced>(getter, ImGui::GetColorU32(n.Spec.FillColor), colors);
+        EndItem();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotTube
+//-----------------------------------------------------------------------------
+
+// Corners of the box around each point of the path of a tube, so fitting and item bounds (see BeginItemEx) account for its radius
+template <typename _Getter> struct GetterTubeBounds {
+    GetterTubeBounds(const _Getter& getter, double radius) : Getter(getter), Radius(radius), Count(getter.Count * 2) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const {
+        const ImPlot3DPoint p = Getter(idx / 2);
+        return idx % 2 == 0 ? p - ImPlot3DPoint(Radius, Radius, Radius) : p + ImPlot3DPoint(Radius, Radius, Radius);
+    }
+    const _Getter& Getter;
+    const double Radius;
+    const int Count;
+};
+
+// Path points and cross-section rings of a tube (see ImPlot3DTube)
+struct GetterTube {
+    GetterTube(const ImPlot3DTube& tube)
+        : Tube(tube), RingSize(tube.RingSize), QuadCount(tube.Ribbon ? tube.RingSize - 1 : tube.RingSize), Count(tube.Points.Size) {}
+    template <typename I> IMPLOT3D_INLINE ImPlot3DPoint operator()(I idx) const { return Tube.Points[idx]; }
+    const ImPlot3DTube& Tube;
+    const int RingSize;  // Vertices per ring
+    const int QuadCount; // Quads between two consecutive rings (the ribbon cross-section is open)
+    const int Count;
+};
+
+// Returns the number of vertices per ring of a tube of #radius, from its largest projected radius in pixels. The count is a power of two from
+// 4 to 32, so that zooming only rebuilds the rings when the projected radius doubles or halves
+static int GetTubeRingSize(const ImPlot3DPlot& plot, double radius) {
+    const double view_scale = plot.GetViewScale();
+    double radius_pix = 0.0;
+    for (int i = 0; i < 3; i++) {
+        const ImPlot3DAxis& axis = plot.Axes[i];
+        const double size = ImAbs(axis.Range.Max - axis.Range.Min);
+        if (size > 0.0)
+            radius_pix = ImMax(radius_pix, radius * view_scale * axis.NDCScale / size);
+    }
+    // Sides of about 4 pixels
+    int ring_size = 4;
+    while (ring_size < 32 && 2.0 * IM_PI * radius_pix / ring_size > 4.0)
+        ring_size *= 2;
+    return ring_size;
+}
+
+// Returns the unit tangent of the path at point #i from its neighbors, or a null vector if they are repeated or NaN
+static ImPlot3DPoint GetTubeTangent(const ImPlot3DPoint* points, int count, int i) {
+    const ImPlot3DPoint d = points[ImMin(i + 1, count - 1)] - points[ImMax(i - 1, 0)];
+    const double length = d.Length();
+    return length > 0.0 ? d / length : ImPlot3DPoint(0.0, 0.0, 0.0);
+}
+
+// Returns the unit vector perpendicular to #tangent that is the closest to the z axis (or to the x axis for vertical tangents)
+static ImPlot3DPoint GetTubeNormal(const ImPlot3DPoint& tangent) {
+    const ImPlot3DPoint up = ImAbs(tangent.z) < 0.9 ? ImPlot3DPoint(0.0, 0.0, 1.0) : ImPlot3DPoint(1.0, 0.0, 0.0);
+    return (up - tangent * up.Dot(tangent)).Normalized();
+}
+
+// Updates the geometry of #tube for the path read through #getter. The parallel-transport frames are computed again only when the data changes
+// (always without a data version), and the rings only when the frames or their shape change
+template <typename _Getter>
+void UpdateTube(ImPlot3DTube& tube, const _Getter& getter, int data_version, double radius, int ring_size, bool ribbon) {
+    const int count = getter.Count;
+    const bool frames_dirty = data_version < 0 || tube.DataVersion != data_version || tube.Points.Size != count;
+    if (frames_dirty) {
+        tube.DataVersion = data_version;
+        tube.Points.resize(count);
+        tube.Normals.resize(count);
+        tube.Binormals.resize(count);
+        for (int i = 0; i < count; i++)
+            tube.Points[i] = getter(i);
+
+        // Start from the first valid tangent, with the normal closest to the z axis
+        ImPlot3DPoint tangent(1.0, 0.0, 0.0);
+        for (int i = 0; i < count; i++) {
+            const ImPlot3DPoint t = GetTubeTangent(tube.Points.Data, count, i);
+            if (t.LengthSquared() > 0.0) {
+                tangent = t;
+                break;
+            }
+        }
+        ImPlot3DPoint normal = GetTubeNormal(tangent);
+
+        // Transport the normal along the path: removing its component along the next tangent rotates it by about the smallest angle between
+        // both tangents, so the frames don't twist around the path. Repeated or NaN points keep the last valid tangent
+        for (int i = 0; i < count; i++) {
+            const ImPlot3DPoint t = GetTubeTangent(tube.Points.Data, count, i);
+            if (t.LengthSquared() > 0.0)
+                tangent = t;
+            normal = normal - tangent * normal.Dot(tangent);
+            const double length = normal.Length();
+            normal = length > 1e-6 ? normal / length : GetTubeNormal(tangent);
+            tube.Normals[i] = normal;
+            tube.Binormals[i] = tangent.Cross(normal);
+        }
+    }
+    if (!frames_dirty && tube.RingSize == ring_size && tube.Ribbon == ribbon && tube.Radius == radius)
+        return;
+
+    // Sweep the cross-section along the frames. The ribbon spans the binormals, so it lies flat for paths in the xy plane
+    tube.RingSize = ring_size;
+    tube.Ribbon = ribbon;
+    tube.Radius = radius;
+    tube.Vertices.resize(count * ring_size);
+    tube.VtxNormals.resize(count * ring_size);
+    for (int i = 0; i < count; i++) {
+        ImPlot3DPoint* vtx = tube.Vertices.Data + i * ring_size;
+        ImPlot3DPoint* vtx_normals = tube.VtxNormals.Data + i * ring_size;
+        const ImPlot3DPoint& p = tube.Points[i];
+        const ImPlot3DPoint& normal = tube.Normals[i];
+        const ImPlot3DPoint& binormal = tube.Binormals[i];
+        if (ribbon) {
+            vtx[0] = p - binormal * radius;
+            vtx[1] = p + binormal * radius;
+            vtx_normals[0] = vtx_normals[1] = normal;
+            continue;
+        }
+        for (int k = 0; k < ring_size; k++) {
+            const float angle = 2 * IM_PI * k / ring_size;
+            vtx_normals[k] = normal * ImCos(angle) + binormal * ImSin(angle);
+            vtx[k] = p + vtx_normals[k] * radius;
+        }
+    }
+}
+
+// Renders one segment of a tube per primitive, as the quads between the rings of its two points with explicit indices and one depth per
+// triangle. Segments are culled as a whole by their bounding sphere. The second ring of a segment is kept as the first ring of the next one, so
+// each ring is projected once per frame. With #shading, each vertex is darkened as its normal turns away from the viewer
+template <class _Getter> struct RendererTube : RendererBase {
+    RendererTube(const _Getter& getter, ImU32 col, bool shading)
+        : RendererBase(getter.Count - 1, 6 * getter.QuadCount, 2 * getter.RingSize), Getter(getter), Col(col), Shading(shading),
+          Projection(*GetCurrentPlot()) {
+        for (int r = 0; r < 2; r++) {
+            RingPix[r] = (ImVec2*)FrameAlloc(sizeof(ImVec2) * Getter.RingSize);
+            RingZ[r] = (double*)FrameAlloc(sizeof(double) * Getter.RingSize);
+            RingCol[r] = (ImU32*)FrameAlloc(sizeof(ImU32) * Getter.RingSize);
+        }
+        Ring0Idx = -1;
+
+        // Normals are transformed to NDC by the inverse of the plot to NDC scales, then rotated. Only their depth component matters for shading
+        const ImPlot3DPlot& plot = *GetCurrentPlot();
+        for (int i = 0; i < 3; i++) {
+            const ImPlot3DAxis& axis = plot.Axes[i];
+            const double sign = ImHasFlag(axis.Flags, ImPlot3DAxisFlags_Invert) ? -1.0 : 1.0;
+            const double ndc_scale = sign * axis.NDCScale / (axis.Range.Max - axis.Range.Min);
+            ImPlot3DPoint axis_dir(0.0, 0.0, 0.0);
+            axis_dir[i] = 1.0;
+            NormalScale[i] = 1.0 / ndc_scale;
+            NormalDepth[i] = (plot.Rotation * axis_dir).z / ndc_scale;
+        }
+    }
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        draw_list_3d.SetPrimFan(0);
+        if (Shading)
+            draw_list_3d.SetVtxStyle(&draw_list_3d._SharedData->TexUvWhitePixel);
+        else
+            draw_list_3d.SetVtxStyle(Col, &draw_list_3d._SharedData->TexUvWhitePixel);
+    }
+
+    // Projects the ring of point #idx into the ring buffers #r
+    IMPLOT3D_INLINE void ProjectRing(int r, int idx) const {
+        const ImPlot3DPoint* vtx = Getter.Tube.Vertices.Data + idx * Getter.RingSize;
+        for (int k = 0; k < Getter.RingSize; k++) {
+            RingPix[r][k] = Projection.ToPixels(vtx[k]);
+            RingZ[r][k] = Projection.ToDepth(vtx[k]);
+        }
+        if (!Shading)
+            return;
+        const ImPlot3DPoint* vtx_normals = Getter.Tube.VtxNormals.Data + idx * Getter.RingSize;
+        for (int k = 0; k < Getter.RingSize; k++) {
+            const ImPlot3DPoint& n = vtx_normals[k];
+            const ImPlot3DPoint n_ndc(n.x * NormalScale[0], n.y * NormalScale[1], n.z * NormalScale[2]);
+            const double facing = ImAbs(n.x * NormalDepth[0] + n.y * NormalDepth[1] + n.z * NormalDepth[2]) / n_ndc.Length();
+            RingCol[r][k] = ImMixU32(Col & IM_COL32_A_MASK, Col, (ImU32)(256 * (0.35 + 0.65 * ImMin(facing, 1.0))));
+        }
+    }
+
+    template <class _CullBox> IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const _CullBox& cull_box, int prim) const {
+        const ImPlot3DPoint& p0 = Getter(prim);
+        const ImPlot3DPoint& p1 = Getter(prim + 1);
+        if (p0.IsNaN() || p1.IsNaN())
+            return false;
+        if (CullSphere(cull_box, (p0 + p1) * 0.5, (p1 - p0).Length() * 0.5 + Getter.Tube.Radius) == ItemCull_Outside)
+            return false;
+
+        // Project both rings, reusing the second ring of the previous segment
+        if (Ring0Idx != prim)
+            ProjectRing(0, prim);
+        ProjectRing(1, prim + 1);
+
+        // 2 vertices per ring vertex
+        const int n = Getter.RingSize;
+        for (int r = 0; r < 2; r++) {
+            for (int k = 0; k < n; k++)
+                draw_list_3d._PosWritePtr[r * n + k] = RingPix[r][k];
+            if (Shading) {
+                for (int k = 0; k < n; k++)
+                    draw_list_3d._ColWritePtr[r * n + k] = RingCol[r][k];
+            }
+        }
+        draw_list_3d._PosWritePtr += 2 * n;
+        if (Shading)
+            draw_list_3d._ColWritePtr += 2 * n;
+
+        // 2 triangles and 2 Z per quad
+        const unsigned int vtx_idx = draw_list_3d._VtxCurrentIdx;
+        for (int q = 0; q < Getter.QuadCount; q++) {
+            const int k0 = q;
+            const int k1 = (q + 1) % n;
+            draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(vtx_idx + k0);
+            draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(vtx_idx + n + k0);
+            draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(vtx_idx + n + k1);
+            draw_list_3d._IdxWritePtr[3] = (ImDrawIdx)(vtx_idx + k0);
+            draw_list_3d._IdxWritePtr[4] = (ImDrawIdx)(vtx_idx + n + k1);
+            draw_list_3d._IdxWritePtr[5] = (ImDrawIdx)(vtx_idx + k1);
+            draw_list_3d._IdxWritePtr += 6;
+            draw_list_3d._ZWritePtr[0] = (RingZ[0][k0] + RingZ[1][k0] + RingZ[1][k1]) / 3;
+            draw_list_3d._ZWritePtr[1] = (RingZ[0][k0] + RingZ[1][k1] + RingZ[0][k1]) / 3;
+            draw_list_3d._ZWritePtr += 2;
+        }
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 2 * n;
+
+        // The second ring becomes the first ring of the next segment
+        ImSwap(RingPix[0], RingPix[1]);
+        ImSwap(RingZ[0], RingZ[1]);
+        ImSwap(RingCol[0], RingCol[1]);
+        Ring0Idx = prim + 1;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    const ImU32 Col;
+    const bool Shading;
+    mutable ModelProjection Projection;
+    mutable ImVec2* RingPix[2]; // Projected rings of the current segment
+    mutable double* RingZ[2];
+    mutable ImU32* RingCol[2];
+    mutable int Ring0Idx;       // Point whose ring is in the first ring buffers, or -1
+    double NormalScale[3];      // Plot to NDC transform of the normals (inverse of the plot to NDC scales)
+    double NormalDepth[3];      // Depth of the normals per plot axis, after the transform to NDC and the rotation
+};
+
+template <typename _Getter> void PlotTubeEx(const char* label_id, const _Getter& getter, double radius, const ImPlot3DSpec& spec) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotTube() needs to be called between BeginPlot() and EndPlot()!");
+    radius = ImAbs(radius);
+
+    // The item bounds and the progressive refinement are cached with the data version, but they also depend on the radius. The tube keeps its
+    // own version, which changes with the version of the caller and with the radius
+    ImPlot3DItemGroup& items = *gp.CurrentItems;
+    ImPlot3DTube& tube = *items.GetOrAddTube(items.GetItemID(label_id));
+    ImPlot3DSpec spec_tube = spec;
+    if (spec.DataVersion >= 0) {
+        if (tube.SpecVersion != spec.DataVersion || tube.SpecRadius != radius) {
+            tube.SpecVersion = spec.DataVersion;
+            tube.SpecRadius = radius;
+            tube.ItemVersion++;
+        }
+        spec_tube.DataVersion = (int)(tube.ItemVersion & 0x7FFFFFFF);
+    }
+
+    if (BeginItemEx(label_id, GetterTubeBounds<_Getter>(getter, radius), spec_tube, spec.FillColor)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+        if (n.RenderFill && radius > 0.0) {
+            const bool ribbon = ImHasFlag(spec.Flags, ImPlot3DTubeFlags_Ribbon);
+            const int ring_size = ribbon ? 2 : GetTubeRingSize(*gp.CurrentPlot, radius);
+            UpdateTube(tube, getter, spec.DataVersion, radius, ring_size, ribbon);
+            RenderPrimitives<RendererTube>(GetterTube(tube), ImGui::GetColorU32(n.Spec.FillColor),
+                                           !ImHasFlag(spec.Flags, ImPlot3DTubeFlags_NoShading));
+        }
+        EndItem();
+    }
+}
+
+IMPLOT3D_TMP void PlotTube(const char* label_id, const T* xs, const T* ys, const T* zs, int count, double radius, const ImPlot3DSpec& spec) {
+    if (count < 2)
+        return;
+    int stride = Stride<T>(spec);
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(ys, count, spec.Offset, stride),
+                                                                  IndexerIdx<T>(zs, count, spec.Offset, stride), count);
+    return PlotTubeEx(label_id, getter, radius, spec);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotTube<T>(const char* label_id, const T* xs, const T* ys, const T* zs, int count, double radius,                    \
+                                           const ImPlot3DSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotImage
 //-----------------------------------------------------------------------------
@@ -1448,14 +3291,7 @@ void PlotText(const char* text, double x, double y, double z, double angle, cons
     SetupLock();
     ImPlot3DPlot& plot = *gp.CurrentPlot;
 
-    ImPlot3DBox cull_box;
-    if (ImHasFlag(plot.Flags, ImPlot3DFlags_NoClip)) {
-        cull_box.Min = ImPlot3DPoint(-HUGE_VAL, -HUGE_VAL, -HUGE_VAL);
-        cull_box.Max = ImPlot3DPoint(HUGE_VAL, HUGE_VAL, HUGE_VAL);
-    } else {
-        cull_box.Min = plot.RangeMin();
-        cull_box.Max = plot.RangeMax();
-    }
+    const ImPlot3DBox cull_box = GetCullBox(plot);
     if (!cull_box.Contains(ImPlot3DPoint(x, y, z)))
         return;
 
@@ -1465,11 +3301,205 @@ void PlotText(const char* text, double x, double y, double z, double angle, cons
     AddTextRotated(GetPlotDrawList(), p, (float)angle, GetStyleColorU32(ImPlot3DCol_InlayText), text);
 }
 
+// Adds the glyph quads of #text centered at #pos to the 3D draw list, all with depth #z. Returns false if the text didn't fit in the draw list
+static bool AddTextDepth(ImDrawList3D& draw_list_3d, ImVec2 pos, const ImVec2& text_size, double z, ImU32 col, const char* text) {
+    ImGuiContext& g = *GImGui;
+#ifdef IMGUI_HAS_TEXTURES
+    ImFontBaked* font = g.Font->GetFontBaked(g.FontSize);
+    const float scale = g.FontSize / font->Size;
+#else
+    ImFont* font = g.Font;
+    const float scale = g.FontSize / font->FontSize;
+#endif
+    const char* text_end = text + strlen(text);
+    const int chars_total = (int)(text_end - text);
+    if (draw_list_3d._VtxCurrentIdx + chars_total * 4 > ImDrawList3D::MaxIdx())
+        return false;
+    draw_list_3d.SetPrimFan(4);
+    draw_list_3d.PrimReserve(chars_total * 6, chars_total * 4);
+
+    int chars_rendered = 0;
+    ImVec2 pen = ImVec2(pos.x - text_size.x * 0.5f, pos.y - text_size.y * 0.5f);
+    const char* s = text;
+    while (s < text_end) {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80) {
+            s += 1;
+        } else {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8?
+                break;
+        }
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == nullptr)
+            continue;
+
+        // Each glyph has its own texture coordinates
+        const ImVec2 uvs[4] = {ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V0), ImVec2(glyph->U1, glyph->V1),
+                               ImVec2(glyph->U0, glyph->V1)};
+        draw_list_3d.SetVtxStyle(col, uvs, 4);
+
+        const ImVec2 p0 = pen + ImVec2(glyph->X0, glyph->Y0) * scale;
+        const ImVec2 p1 = pen + ImVec2(glyph->X1, glyph->Y1) * scale;
+        draw_list_3d._PosWritePtr[0] = p0;
+        draw_list_3d._PosWritePtr[1] = ImVec2(p1.x, p0.y);
+        draw_list_3d._PosWritePtr[2] = p1;
+        draw_list_3d._PosWritePtr[3] = ImVec2(p0.x, p1.y);
+        draw_list_3d._PosWritePtr += 4;
+        draw_list_3d._ZWritePtr[0] = z;
+        draw_list_3d._ZWritePtr++;
+        draw_list_3d._VtxCurrentIdx += 4;
+
+        pen.x += glyph->AdvanceX * scale;
+        chars_rendered++;
+    }
+
+    // Return unused vertices
+    const int chars_skipped = chars_total - chars_rendered;
+    draw_list_3d.PrimUnreserve(chars_skipped * 6, chars_skipped * 4);
+    return true;
+}
+
+template <typename _Getter> void PlotTextsEx(const char* const* labels, const _Getter& getter, ImPlot3DTextFlags flags, const ImVec2& pix_offset) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotTexts() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImPlot3DBox cull_box = GetCullBox(plot);
+    const ImU32 col = GetStyleColorU32(ImPlot3DCol_InlayText);
+
+    // Project and measure the labels inside the plot box
+    struct TextLabel {
+        ImRect Rect;
+        ImVec2 Pos;
+        double Z;
+        const char* Text;
+    };
+    TextLabel* items = (TextLabel*)FrameAlloc(sizeof(TextLabel) * getter.Count);
+    ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    const bool depth_sort = ImHasFlag(flags, ImPlot3DTextFlags_DepthSort);
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    ImVec2 max_size(1.0f, 1.0f);
+    int item_count = 0;
+    for (int i = 0; i < getter.Count; i++) {
+        const char* text = labels[i];
+        if (text == nullptr || text[0] == '\0')
+            continue;
+        const ImPlot3DPoint p = getter(i);
+        if (!cull_box.Contains(p))
+            continue;
+        TextLabel& item = items[item_count++];
+        item.Pos = ImFloor(PlotToPixels(p) + pix_offset);
+        item.Z = depth_sort ? GetPointDepth(p) : 0.0;
+        item.Text = text;
+        const ImVec2 size = font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text);
+        item.Rect = ImRect(item.Pos - size * 0.5f, item.Pos + size * 0.5f);
+        bounds.Add(item.Rect);
+        max_size = ImMax(max_size, size);
+    }
+
+    // Drop the labels overlapping a previous one. Accepted labels are binned in a grid with cells larger than any label, so a label covers at
+    // most 2x2 cells and only the labels binned in those cells need to be tested
+    if (!ImHasFlag(flags, ImPlot3DTextFlags_NoCollision) && item_count > 1) {
+        const int grid_w = ImClamp((int)(bounds.GetWidth() / max_size.x), 1, 256);
+        const int grid_h = ImClamp((int)(bounds.GetHeight() / max_size.y), 1, 256);
+        const ImVec2 inv_cell = ImVec2(grid_w / ImMax(bounds.GetWidth(), 1.0f), grid_h / ImMax(bounds.GetHeight(), 1.0f));
+        int* cell_first = (int*)FrameAlloc(sizeof(int) * grid_w * grid_h);
+        for (int i = 0; i < grid_w * grid_h; i++)
+            cell_first[i] = -1;
+        struct CellNode {
+            int Item;
+            int Next;
+        };
+        CellNode* nodes = (CellNode*)FrameAlloc(sizeof(CellNode) * item_count * 4);
+        int node_count = 0;
+        int accepted = 0;
+        for (int i = 0; i < item_count; i++) {
+            const ImRect rect = items[i].Rect;
+            const int x0 = ImClamp((int)((rect.Min.x - bounds.Min.x) * inv_cell.x), 0, grid_w - 1);
+            const int y0 = ImClamp((int)((rect.Min.y - bounds.Min.y) * inv_cell.y), 0, grid_h - 1);
+            // A label as wide or tall as a cell may reach a third cell by rounding, clamp it to the 2x2 cells the nodes are allocated for
+            const int x1 = ImClamp((int)((rect.Max.x - bounds.Min.x) * inv_cell.x), 0, ImMin(x0 + 1, grid_w - 1));
+            const int y1 = ImClamp((int)((rect.Max.y - bounds.Min.y) * inv_cell.y), 0, ImMin(y0 + 1, grid_h - 1));
+            bool overlaps = false;
+            for (int y = y0; y <= y1 && !overlaps; y++)
+                for (int x = x0; x <= x1 && !overlaps; x++)
+                    for (int n = cell_first[y * grid_w + x]; n != -1 && !overlaps; n = nodes[n].Next)
+                        overlaps = items[nodes[n].Item].Rect.Overlaps(rect);
+            if (overlaps)
+                continue;
+            // Keep the label, compacting the accepted labels at the front of the array
+            items[accepted] = items[i];
+            for (int y = y0; y <= y1; y++) {
+                for (int x = x0; x <= x1; x++) {
+                    nodes[node_count].Item = accepted;
+                    nodes[node_count].Next = cell_first[y * grid_w + x];
+                    cell_first[y * grid_w + x] = node_count++;
+                }
+            }
+            accepted++;
+        }
+        item_count = accepted;
+    }
+
+    if (depth_sort) {
+        // Glyph quads are sorted with the plot geometry. Labels have no data version, so the plot can't be refined progressively
+        plot.Progressive.AllVersioned = false;
+        for (int i = 0; i < item_count; i++)
+            if (!AddTextDepth(plot.DrawList, items[i].Pos, items[i].Rect.GetSize(), items[i].Z, col, items[i].Text))
+                break;
+    } else {
+        ImDrawList* draw_list = GetPlotDrawList();
+        for (int i = 0; i < item_count; i++)
+            AddTextRotated(draw_list, items[i].Pos, 0.0f, col, items[i].Text);
+    }
+}
+
+template <typename T>
+void PlotTexts(const char* const* labels, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTextFlags flags, const ImVec2& pix_offset) {
+    if (count < 1)
+        return;
+    GetterXYZ<IndexerIdx<T>, IndexerIdx<T>, IndexerIdx<T>> getter(IndexerIdx<T>(xs, count, 0, sizeof(T)), IndexerIdx<T>(ys, count, 0, sizeof(T)),
+                                                                  IndexerIdx<T>(zs, count, 0, sizeof(T)), count);
+    PlotTextsEx(labels, getter, flags, pix_offset);
+}
+
+#define INSTANTIATE_MACRO(T)                                                                                                                         \
+    template IMPLOT3D_API void PlotTexts<T>(const char* const* labels, const T* xs, const T* ys, const T* zs, int count, ImPlot3DTextFlags flags,    \
+                                            const ImVec2& pix_offset);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 void PlotDummy(const char* label_id, const ImPlot3DSpec& spec) {
     if (BeginItem(label_id, spec, spec.LineColor, spec.Marker))
         EndItem();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Custom 3D Rendering
+//-----------------------------------------------------------------------------
+
+void AddTriangles3D(const ImPlot3DPoint* vtx, int count, ImU32 col) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "AddTriangles3D() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    if (count < 3)
+        return;
+    Getter3DPoints getter(vtx, count);
+    RenderPrimitives<RendererTriangleFill>(getter, col);
+}
+
+void AddLines3D(const ImPlot3DPoint* vtx, int count, ImU32 col, float thickness) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "AddLines3D() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    if (count < 2)
+        return;
+    Getter3DPoints getter(vtx, count);
+    RenderPrimitives<RendererLineSegments>(getter, col, thickness);
+}
+
 } // namespace ImPlot3D
 
 #endif // #ifndef IMGUI_DISABLE